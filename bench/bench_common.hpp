@@ -0,0 +1,50 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string_view>
+
+namespace poolfactory::bench {
+
+/**
+ * @brief Keep a value alive so the optimizer cannot drop the computation
+ */
+template <typename T> inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief Run f() `iterations` times and print the mean cost per call
+ *
+ * Returns ns/op so callers can print ratios between cases.
+ */
+template <typename F>
+auto run(std::string_view name, std::size_t iterations, F&& f) -> double {
+    // Warm-up pass: populate pools, caches and branch predictors
+    for (std::size_t i = 0; i < iterations / 10; ++i) {
+        f();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        f();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    auto ns = std::chrono::duration<double, std::nano>(elapsed).count() /
+              static_cast<double>(iterations);
+    std::printf("%-48.*s %10.2f ns/op\n", static_cast<int>(name.size()), name.data(), ns);
+    return ns;
+}
+
+inline void section(std::string_view title) {
+    std::printf("\n== %.*s ==\n", static_cast<int>(title.size()), title.data());
+}
+
+} // namespace poolfactory::bench
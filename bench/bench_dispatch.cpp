@@ -0,0 +1,145 @@
+// Static (CRTP) pool dispatch vs the previous virtual Pool/ThreadSafePool design.
+//
+// The "virtual" cases reproduce the old layout: acquire()/do_release() are
+// virtual, the pool is used through a base reference and every handle
+// releases through PooledResource's type-erased releaser.
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "bench_common.hpp"
+#include "poolfactory/pool_factory.hpp"
+
+using namespace poolfactory;
+
+namespace {
+
+constexpr std::size_t iterations = 5'000'000;
+
+template <typename T> class VirtualPool {
+  public:
+    using Factory = std::function<Result<T>()>;
+    using Handle = std::pair<T, std::function<void(T)>>;
+
+    explicit VirtualPool(Factory factory) : factory_(std::move(factory)) {}
+    virtual ~VirtualPool() = default;
+
+    virtual auto acquire() -> Result<Handle> {
+        if (!available_.empty()) {
+            T resource = std::move(available_.front());
+            available_.pop_front();
+            ++in_use_;
+            return Result<Handle>::ok(
+                {std::move(resource), [this](T r) { do_release(std::move(r)); }});
+        }
+        auto created = factory_();
+        ++in_use_;
+        return Result<Handle>::ok(
+            {std::move(created).value(), [this](T r) { do_release(std::move(r)); }});
+    }
+
+    template <typename F> auto with_resource(F&& f) -> Result<int> {
+        auto acquired = acquire();
+        if (acquired.is_err()) {
+            return Result<int>::err(std::move(acquired).error());
+        }
+        auto [resource, releaser] = std::move(acquired).value();
+        int out = f(resource);
+        releaser(std::move(resource));
+        return Result<int>::ok(out);
+    }
+
+  protected:
+    virtual void do_release(T resource) {
+        --in_use_;
+        available_.push_back(std::move(resource));
+    }
+
+    Factory factory_;
+    std::deque<T> available_;
+    std::size_t in_use_{0};
+};
+
+template <typename T> class VirtualThreadSafePool final : public VirtualPool<T> {
+  public:
+    using VirtualPool<T>::VirtualPool;
+
+    using typename VirtualPool<T>::Handle;
+
+    auto acquire() -> Result<Handle> override {
+        std::unique_lock lock(mutex_);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{30};
+        while (this->available_.empty() && this->in_use_ >= 4) {
+            if (cv_.wait_until(lock, deadline) == std::cv_status::timeout) {
+                return Result<Handle>::err("Pool acquire timeout");
+            }
+        }
+        return VirtualPool<T>::acquire();
+    }
+
+  protected:
+    void do_release(T resource) override {
+        {
+            std::lock_guard lock(mutex_);
+            VirtualPool<T>::do_release(std::move(resource));
+        }
+        cv_.notify_one();
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+// Opaque to the optimizer, so calls through the base stay virtual
+[[gnu::noinline]] auto make_virtual_pool(bool thread_safe) -> std::unique_ptr<VirtualPool<int>> {
+    auto factory = []() { return Result<int>::ok(1); };
+    if (thread_safe) {
+        return std::make_unique<VirtualThreadSafePool<int>>(factory);
+    }
+    return std::make_unique<VirtualPool<int>>(factory);
+}
+
+auto work(int& n) -> int { return ++n; }
+
+} // namespace
+
+auto main() -> int {
+    auto factory = []() { return Result<int>::ok(1); };
+    auto config = default_config.with_min_size(1).with_max_size(4).with_validation(false, false);
+
+    bench::section("single-threaded with_resource");
+    auto virtual_pool = make_virtual_pool(false);
+    auto virtual_ns = bench::run("virtual Pool<int>", iterations, [&] {
+        bench::do_not_optimize(virtual_pool->with_resource(work));
+    });
+
+    auto pool = PoolFactory::create<int>(factory, config).value();
+    auto static_ns = bench::run("CRTP Pool<int>", iterations, [&] {
+        bench::do_not_optimize(pool->with_resource(work));
+    });
+    std::printf("speedup: %.2fx\n", virtual_ns / static_ns);
+
+    bench::section("single-threaded acquire + PooledResource");
+    bench::run("CRTP Pool<int>::acquire", iterations, [&] {
+        auto handle = pool->acquire();
+        bench::do_not_optimize(handle);
+    });
+
+    bench::section("thread-safe with_resource (uncontended)");
+    auto virtual_ts = make_virtual_pool(true);
+    auto virtual_ts_ns = bench::run("virtual ThreadSafePool<int>", iterations, [&] {
+        bench::do_not_optimize(virtual_ts->with_resource(work));
+    });
+
+    auto ts_pool = PoolFactory::create_thread_safe<int>(factory, config).value();
+    auto static_ts_ns = bench::run("CRTP ThreadSafePool<int>", iterations, [&] {
+        bench::do_not_optimize(ts_pool->with_resource(work));
+    });
+    std::printf("speedup: %.2fx\n", virtual_ts_ns / static_ts_ns);
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+// Error-handling strategies on the same pipeline: Result vs exceptions vs
+// std::expected, across failure ratios.
+//
+// Each strategy lives in its own translation unit (error_handling/); the
+// build prints their object sizes after linking this target.
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "error_handling/pipelines.hpp"
+
+using namespace poolfactory;
+
+namespace {
+
+constexpr std::size_t input_count = 4096;
+constexpr std::size_t iterations = 4'000'000;
+
+// Mix of valid inputs and failures at every stage, `failure_percent` failing
+auto make_inputs(unsigned failure_percent) -> std::vector<std::string> {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::uniform_int_distribution<int> valid(0, 99'998);
+
+    std::vector<std::string> inputs;
+    inputs.reserve(input_count);
+    for (std::size_t i = 0; i < input_count; ++i) {
+        if (static_cast<unsigned>(percent(rng)) >= failure_percent) {
+            auto value = valid(rng);
+            inputs.push_back(std::to_string(value % 1000 == 999 ? value - 1 : value));
+            continue;
+        }
+        switch (i % 3) {
+        case 0:
+            inputs.emplace_back("12x4");
+            break;
+        case 1:
+            inputs.emplace_back("250000");
+            break;
+        default:
+            inputs.emplace_back("1999");
+            break;
+        }
+    }
+    return inputs;
+}
+
+auto bench_strategy(const char* name,
+                    const std::vector<std::string>& inputs,
+                    int (*pipeline)(std::string_view)) -> double {
+    std::size_t i = 0;
+    return bench::run(name, iterations, [&] {
+        bench::do_not_optimize(pipeline(inputs[i++ % input_count]));
+    });
+}
+
+} // namespace
+
+auto main() -> int {
+    if (!bench::has_expected) {
+        std::puts("std::expected unavailable (needs C++23); skipping it");
+    }
+
+    for (unsigned failure_percent : {0U, 1U, 10U, 50U, 100U}) {
+        std::printf("\n== %u%% of inputs fail ==\n", failure_percent);
+        auto inputs = make_inputs(failure_percent);
+
+        auto result_ns =
+            bench_strategy("Result::and_then/map/or_else", inputs, bench::result_pipeline);
+        auto exception_ns =
+            bench_strategy("exceptions (throw/catch)", inputs, bench::exception_pipeline);
+        std::printf("exceptions / Result: %.2fx\n", exception_ns / result_ns);
+
+        if (bench::has_expected) {
+            auto expected_ns = bench_strategy("std::expected", inputs, bench::expected_pipeline);
+            std::printf("std::expected / Result: %.2fx\n", expected_ns / result_ns);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+// False sharing between pool writers and config()/stats-style readers.
+//
+// Writer threads churn acquire/release while reader threads poll read-mostly
+// state. "packed" reproduces the old layout (config next to the mutex and
+// counters); "split" is the hot/cold layout pools use now. Reported numbers
+// are the readers' cost per read: with false sharing each read misses.
+// Needs at least two cores to show a difference.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "poolfactory/cache_line.hpp"
+#include "poolfactory/pool_factory.hpp"
+
+using namespace poolfactory;
+
+namespace {
+
+constexpr auto run_time = std::chrono::milliseconds{300};
+
+struct PackedState {
+    PoolConfig config;
+    std::mutex mutex;
+    std::size_t in_use{0};
+    std::size_t total_created{0};
+};
+
+struct SplitState {
+    PoolConfig config;
+    alignas(cache_line_size) std::mutex mutex;
+    std::size_t in_use{0};
+    std::size_t total_created{0};
+};
+
+/**
+ * @brief Run writers and readers concurrently, return reader ns/read
+ */
+template <typename Write, typename Read>
+auto contend(const char* name, unsigned writers, unsigned readers, Write write, Read read)
+    -> double {
+    std::atomic<bool> stop{false};
+    std::atomic<std::size_t> total_reads{0};
+    std::vector<std::thread> threads;
+
+    for (unsigned i = 0; i < writers; ++i) {
+        threads.emplace_back([&] {
+            while (!stop.load(std::memory_order_relaxed)) {
+                write();
+            }
+        });
+    }
+    for (unsigned i = 0; i < readers; ++i) {
+        threads.emplace_back([&] {
+            std::size_t reads = 0;
+            std::size_t sink = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                sink += read();
+                ++reads;
+            }
+            bench::do_not_optimize(sink);
+            total_reads.fetch_add(reads);
+        });
+    }
+
+    std::this_thread::sleep_for(run_time);
+    stop.store(true);
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto ns = std::chrono::duration<double, std::nano>(run_time).count() * readers /
+              static_cast<double>(std::max<std::size_t>(total_reads.load(), 1));
+    std::printf("%-48s %10.2f ns/read\n", name, ns);
+    return ns;
+}
+
+template <typename State>
+auto bench_layout(const char* name, unsigned writers, unsigned readers) -> double {
+    State state;
+    return contend(
+        name,
+        writers,
+        readers,
+        [&] {
+            std::lock_guard lock(state.mutex);
+            ++state.in_use;
+            ++state.total_created;
+        },
+        [&] {
+            // Volatile read: the config must be re-read from memory each time
+            return static_cast<const volatile std::size_t&>(state.config.max_size);
+        });
+}
+
+} // namespace
+
+auto main() -> int {
+    unsigned cores = std::max(2U, std::thread::hardware_concurrency());
+    unsigned writers = cores / 2;
+    unsigned readers = cores - writers;
+    std::printf("%u writer(s), %u reader(s)\n", writers, readers);
+
+    bench::section("layout only: config reads vs locked counter writes");
+    auto packed = bench_layout<PackedState>("packed (config shares a line)", writers, readers);
+    auto split = bench_layout<SplitState>("split (hot/cold, cache-line aligned)", writers, readers);
+    std::printf("speedup: %.2fx\n", packed / split);
+
+    bench::section("ThreadSafePool<int>: config() under acquire/release churn");
+    auto pool = PoolFactory::create_thread_safe<int>([]() { return Result<int>::ok(1); },
+                                                     default_config.with_max_size(64))
+                    .value();
+    std::printf("sizeof(ThreadSafePool<int>) = %zu, alignment = %zu\n",
+                sizeof(ThreadSafePool<int>),
+                alignof(ThreadSafePool<int>));
+    contend(
+        "ThreadSafePool config()",
+        writers,
+        readers,
+        [&] { bench::do_not_optimize(pool->with_resource([](int& n) { return ++n; })); },
+        [&] {
+            const auto& config = pool->config();
+            return static_cast<const volatile std::size_t&>(config.max_size);
+        });
+
+    return 0;
+}
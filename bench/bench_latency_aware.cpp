@@ -0,0 +1,78 @@
+// LatencyAwarePool vs ThreadSafePool with unevenly degraded replicas.
+//
+// Four replica connections answer in 2 us, one has degraded to 100 us. The
+// FIFO pool rotates through all of them; the latency-aware pool learns the
+// hold times and stops picking the slow one after its first use.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "poolfactory/pool_factory.hpp"
+
+using namespace poolfactory;
+
+namespace {
+
+constexpr std::size_t requests = 20'000;
+constexpr std::size_t replicas = 5;
+
+struct Replica {
+    std::chrono::nanoseconds latency;
+};
+
+// Busy-wait: sleeping would measure the scheduler, not the replica
+void call(const Replica& replica) {
+    auto until = std::chrono::steady_clock::now() + replica.latency;
+    while (std::chrono::steady_clock::now() < until) {
+    }
+}
+
+template <typename PoolPtr> void measure(const char* name, const PoolPtr& pool) {
+    std::vector<double> samples;
+    samples.reserve(requests);
+    for (std::size_t i = 0; i < requests; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        bench::do_not_optimize(pool->with_resource([](Replica& r) { call(r); }));
+        samples.push_back(
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+                .count());
+    }
+    std::sort(samples.begin(), samples.end());
+    double mean = 0;
+    for (double s : samples) {
+        mean += s / static_cast<double>(samples.size());
+    }
+    std::printf("%-40s mean %8.2f us   p99 %8.2f us\n",
+                name,
+                mean,
+                samples[samples.size() * 99 / 100]);
+}
+
+} // namespace
+
+auto main() -> int {
+    // The first replica created is the degraded one: it sits at the front
+    auto make_factory = [] {
+        return [created = std::size_t{0}]() mutable {
+            auto latency = created++ % replicas == 0 ? std::chrono::microseconds{100}
+                                                     : std::chrono::microseconds{2};
+            return Result<Replica>::ok(Replica{latency});
+        };
+    };
+    auto config = default_config.with_min_size(replicas)
+                      .with_max_size(replicas)
+                      .with_validation(false, false);
+
+    auto fifo = PoolFactory::create_thread_safe<Replica>(make_factory(), config).value();
+    auto scored = PoolFactory::create_latency_aware<Replica>(make_factory(), config).value();
+
+    bench::section("request latency, 1 of 5 replicas degraded 50x");
+    measure("ThreadSafePool<Replica> (FIFO)", fifo);
+    measure("LatencyAwarePool<Replica> (least EWMA)", scored);
+    std::printf("stragglers retired: %zu\n", scored->stats().retired);
+
+    return 0;
+}
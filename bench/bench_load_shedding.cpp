@@ -0,0 +1,83 @@
+// ThreadSafePool load shedding when load goes from slow to fast.
+//
+// Workers hold one of two connections, first for 50 ms (a release every
+// 25 ms, past the 10 ms acquire timeout), then for 0.2 ms. In the slow phase
+// acquires are shed instead of queueing into a timeout; once holds get
+// short, the release-gap estimate must follow so acquires are served
+// again. Exits non-zero if the fast phase still sheds over a tenth of its
+// acquires.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "poolfactory/pool_factory.hpp"
+
+using namespace poolfactory;
+
+namespace {
+
+constexpr unsigned workers = 8;
+constexpr auto phase_length = std::chrono::milliseconds{400};
+constexpr auto backoff = std::chrono::milliseconds{1}; // after a refused acquire
+
+struct Counts {
+    std::atomic<std::size_t> served{0};
+    std::atomic<std::size_t> shed{0};
+    std::atomic<std::size_t> timed_out{0};
+};
+
+template <typename PoolPtr>
+void phase(const char* name, const PoolPtr& pool, std::chrono::microseconds hold, Counts& counts) {
+    auto until = std::chrono::steady_clock::now() + phase_length;
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < workers; ++t) {
+        threads.emplace_back([&] {
+            while (std::chrono::steady_clock::now() < until) {
+                auto handle = pool->acquire();
+                if (handle.is_ok()) {
+                    std::this_thread::sleep_for(hold);
+                    counts.served.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                auto& counter =
+                    handle.error() == PoolErrc::overloaded ? counts.shed : counts.timed_out;
+                counter.fetch_add(1, std::memory_order_relaxed);
+                std::this_thread::sleep_for(backoff);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::printf("%-28s served %6zu   shed %6zu   timed out %6zu\n",
+                name,
+                counts.served.load(),
+                counts.shed.load(),
+                counts.timed_out.load());
+}
+
+} // namespace
+
+auto main() -> int {
+    auto config = default_config.with_min_size(2)
+                      .with_max_size(2)
+                      .with_acquire_timeout(std::chrono::milliseconds{10})
+                      .with_load_shedding(0); // no queue cap: expected-wait shedding only
+    auto pool =
+        PoolFactory::create_thread_safe<int>([] { return Result<int>::ok(0); }, config).value();
+
+    Counts slow;
+    Counts fast;
+    phase("slow (50 ms holds)", pool, std::chrono::milliseconds{50}, slow);
+    phase("fast (0.2 ms holds)", pool, std::chrono::microseconds{200}, fast);
+
+    // Fast holds leave a waiter well inside its timeout: shedding must stop
+    auto attempts = fast.served.load() + fast.shed.load() + fast.timed_out.load();
+    bool recovered = fast.shed.load() * 10 < attempts;
+    std::printf("estimate recovered: %s\n", recovered ? "yes" : "no");
+    return recovered ? EXIT_SUCCESS : EXIT_FAILURE;
+}
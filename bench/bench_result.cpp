@@ -0,0 +1,133 @@
+// Monadic chain cost: union-based Result vs the previous std::variant layout.
+//
+// legacy::Result reproduces the old representation (std::variant<Ok, Err>,
+// std::get on every access, map_err without an rvalue overload) so both can
+// run the same pipeline side by side.
+
+#include <cstdio>
+#include <string>
+#include <variant>
+
+#include "bench_common.hpp"
+#include "poolfactory/pool_error.hpp"
+#include "poolfactory/result.hpp"
+
+using namespace poolfactory;
+
+namespace legacy {
+
+template <typename T, typename E = std::string> class Result {
+  public:
+    static auto ok(T value) -> Result { return Result{Ok<T>{std::move(value)}}; }
+    static auto err(E error) -> Result { return Result{Err<E>{std::move(error)}}; }
+
+    Result(Ok<T> ok) : data_(std::move(ok)) {}
+    Result(Err<E> err) : data_(std::move(err)) {}
+
+    [[nodiscard]] auto is_ok() const -> bool { return std::holds_alternative<Ok<T>>(data_); }
+    [[nodiscard]] auto is_err() const -> bool { return !is_ok(); }
+
+    [[nodiscard]] auto value() const& -> const T& { return std::get<Ok<T>>(data_).value; }
+    [[nodiscard]] auto value() && -> T { return std::move(std::get<Ok<T>>(data_).value); }
+    [[nodiscard]] auto error() const& -> const E& { return std::get<Err<E>>(data_).value; }
+    [[nodiscard]] auto error() && -> E { return std::move(std::get<Err<E>>(data_).value); }
+
+    template <typename F> auto map(F&& f) && -> Result<decltype(f(std::declval<T>())), E> {
+        using U = decltype(f(std::declval<T>()));
+        if (is_ok()) {
+            return Result<U, E>::ok(f(std::move(*this).value()));
+        }
+        return Result<U, E>::err(std::move(*this).error());
+    }
+
+    // The old map_err only had a const& overload: the value is copied
+    template <typename F>
+    auto map_err(F&& f) const& -> Result<T, decltype(f(std::declval<const E&>()))> {
+        using U = decltype(f(std::declval<const E&>()));
+        if (is_err()) {
+            return Result<T, U>::err(f(error()));
+        }
+        return Result<T, U>::ok(value());
+    }
+
+    template <typename F> auto and_then(F&& f) && -> decltype(f(std::declval<T>())) {
+        using R = decltype(f(std::declval<T>()));
+        if (is_ok()) {
+            return f(std::move(*this).value());
+        }
+        return R::err(std::move(*this).error());
+    }
+
+    [[nodiscard]] auto value_or(T default_val) && -> T {
+        if (is_ok()) {
+            return std::move(*this).value();
+        }
+        return default_val;
+    }
+
+  private:
+    std::variant<Ok<T>, Err<E>> data_;
+};
+
+} // namespace legacy
+
+namespace {
+
+constexpr std::size_t iterations = 10'000'000;
+
+template <template <typename, typename> class R, typename E>
+auto pipeline(int input, const E& failure) -> int {
+    auto parsed = input >= 0 ? R<int, E>::ok(input) : R<int, E>::err(failure);
+    return std::move(parsed)
+        .map([](int v) { return v * 2; })
+        .and_then([&](int v) {
+            return v < 1'000'000 ? R<int, E>::ok(v + 1) : R<int, E>::err(failure);
+        })
+        .map_err([](E e) { return e; })
+        .map([](int v) { return v - 1; })
+        .value_or(-1);
+}
+
+template <template <typename, typename> class R, typename E>
+auto run_pipeline(const char* name, const E& failure, int fail_every) -> double {
+    int i = 0;
+    return bench::run(name, iterations, [&] {
+        int input = (++i % fail_every == 0) ? -1 : i & 0xffff;
+        bench::do_not_optimize(pipeline<R, E>(input, failure));
+    });
+}
+
+template <typename T, typename E> using Current = poolfactory::Result<T, E>;
+template <typename T, typename E> using Legacy = legacy::Result<T, E>;
+
+} // namespace
+
+auto main() -> int {
+    std::printf("sizeof PoolError: %zu (previously code + shared_ptr: 24)\n", sizeof(PoolError));
+    std::printf("sizeof Result<int, std::string>: legacy %zu, current %zu\n",
+                sizeof(Legacy<int, std::string>),
+                sizeof(Current<int, std::string>));
+    std::printf("sizeof Result<int, PoolError>:   legacy %zu, current %zu\n",
+                sizeof(Legacy<int, PoolError>),
+                sizeof(Current<int, PoolError>));
+    std::printf("sizeof Result<int, PoolErrc>:    legacy %zu, current %zu\n",
+                sizeof(Legacy<int, PoolErrc>),
+                sizeof(Current<int, PoolErrc>));
+
+    const std::string string_error = "pipeline input rejected: value out of range";
+    const PoolError pool_error{PoolErrc::exhausted};
+
+    for (int fail_every : {1'000'000, 10, 2}) {
+        std::printf("\n== 1 in %d inputs fails ==\n", fail_every);
+        auto a = run_pipeline<Legacy>("legacy  E=std::string", string_error, fail_every);
+        auto b = run_pipeline<Current>("current E=std::string", string_error, fail_every);
+        auto c = run_pipeline<Legacy>("legacy  E=PoolError", pool_error, fail_every);
+        auto d = run_pipeline<Current>("current E=PoolError", pool_error, fail_every);
+        auto e = run_pipeline<Legacy>("legacy  E=PoolErrc", PoolErrc::exhausted, fail_every);
+        auto f = run_pipeline<Current>("current E=PoolErrc", PoolErrc::exhausted, fail_every);
+        std::printf(
+            "speedup: string %.2fx, PoolError %.2fx, PoolErrc %.2fx\n", a / b, c / d, e / f);
+    }
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+// SharedLeasePool vs ThreadSafePool for a multiplexed resource.
+//
+// Every core runs with_resource concurrently with a short hold. The
+// exclusive pool needs one resource per concurrent borrower; the shared
+// pool serves them from resources leased up to K times each.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "poolfactory/pool_factory.hpp"
+
+using namespace poolfactory;
+
+namespace {
+
+constexpr std::size_t iterations = 500'000;
+constexpr std::size_t max_leases = 8;
+
+// Stand-in for one request on a channel that serves many at once
+auto request = [](std::atomic<int>& channel) {
+    return channel.fetch_add(1, std::memory_order_relaxed);
+};
+
+template <typename PoolPtr>
+auto contended(const char* name, const PoolPtr& pool, unsigned threads) -> double {
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            for (std::size_t i = 0; i < iterations; ++i) {
+                bench::do_not_optimize(pool->with_resource([](auto& channel) {
+                    return request(*channel);
+                }));
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    auto ns = std::chrono::duration<double, std::nano>(elapsed).count() /
+              static_cast<double>(iterations * threads);
+    std::printf("%-48s %10.2f ns/op  %3zu resource(s)\n", name, ns, pool->stats().total_created);
+    return ns;
+}
+
+} // namespace
+
+auto main() -> int {
+    using Channel = std::shared_ptr<std::atomic<int>>;
+    auto factory = []() { return Result<Channel>::ok(std::make_shared<std::atomic<int>>(0)); };
+
+    unsigned threads = std::max(2U, std::thread::hardware_concurrency());
+    auto config = default_config.with_max_size(threads).with_validation(false, false);
+
+    auto exclusive = PoolFactory::create_thread_safe<Channel>(factory, config).value();
+    auto shared = PoolFactory::create_shared_lease<Channel>(factory, max_leases, config).value();
+
+    bench::section("contended with_resource on a multiplexed channel");
+    std::printf("%u thread(s), up to %zu leases per resource\n", threads, max_leases);
+    auto exclusive_ns = contended("ThreadSafePool<Channel>", exclusive, threads);
+    auto shared_ns = contended("SharedLeasePool<Channel> (P2C)", shared, threads);
+    std::printf("speedup: %.2fx\n", exclusive_ns / shared_ns);
+
+    return 0;
+}
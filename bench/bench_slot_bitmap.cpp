@@ -0,0 +1,55 @@
+// Free-slot lookup cost: flat word scan vs hierarchical summary bits.
+//
+// Worst case for the flat scan: every slot but the last few is taken,
+// so each acquire has to skip N/64 empty words.
+
+#include <cstdio>
+#include <memory>
+
+#include "bench_common.hpp"
+#include "poolfactory/slot_bitmap.hpp"
+
+using namespace poolfactory;
+
+namespace {
+
+constexpr std::size_t iterations = 2'000'000;
+
+template <std::size_t N, SlotIndex Index> auto bench_tail_free(const char* name) -> double {
+    auto free_slots = std::make_unique<SlotBitmap<N, Index>>();
+    free_slots->set(N - 1);
+    free_slots->set(N - 2);
+
+    return bench::run(name, iterations, [&] {
+        auto slot = free_slots->find_first();
+        free_slots->reset(slot);
+        bench::do_not_optimize(slot);
+        free_slots->set(slot);
+    });
+}
+
+} // namespace
+
+auto main() -> int {
+#if defined(__AVX512F__)
+    std::puts("flat scan: AVX-512");
+#elif defined(__AVX2__)
+    std::puts("flat scan: AVX2");
+#else
+    std::puts("flat scan: scalar tzcnt");
+#endif
+
+    bench::section("1024 slots, free slot at the end");
+    bench_tail_free<1024, SlotIndex::flat>("flat");
+    bench_tail_free<1024, SlotIndex::hierarchical>("hierarchical");
+
+    bench::section("16384 slots, free slot at the end");
+    bench_tail_free<16384, SlotIndex::flat>("flat");
+    bench_tail_free<16384, SlotIndex::hierarchical>("hierarchical");
+
+    bench::section("262144 slots, free slot at the end");
+    bench_tail_free<max_hierarchical_slots, SlotIndex::flat>("flat");
+    bench_tail_free<max_hierarchical_slots, SlotIndex::hierarchical>("hierarchical");
+
+    return 0;
+}
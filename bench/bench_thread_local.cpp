@@ -0,0 +1,102 @@
+// ThreadLocalPool vs ThreadSafePool.
+//
+// Same-thread: with_resource on one thread (mutex vs thread-local shard).
+// Contended: every core runs with_resource concurrently on one shared pool.
+// Remote release: handles acquired on one thread, released on another, so
+// the thread-local pool goes through its remote-free stack.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "poolfactory/pool_factory.hpp"
+
+using namespace poolfactory;
+
+namespace {
+
+constexpr std::size_t iterations = 5'000'000;
+constexpr std::size_t contended_iterations = 1'000'000;
+constexpr std::size_t batch = 64;
+
+auto work = [](int& n) { return ++n; };
+
+template <typename PoolPtr>
+auto contended(const char* name, const PoolPtr& pool, unsigned threads) -> double {
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            for (std::size_t i = 0; i < contended_iterations; ++i) {
+                bench::do_not_optimize(pool->with_resource(work));
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    auto ns = std::chrono::duration<double, std::nano>(elapsed).count() /
+              static_cast<double>(contended_iterations * threads);
+    std::printf("%-48s %10.2f ns/op\n", name, ns);
+    return ns;
+}
+
+// Acquire `batch` handles here, release them all on another thread
+template <typename PoolPtr> auto remote_release(const char* name, const PoolPtr& pool) -> double {
+    constexpr std::size_t rounds = iterations / batch / 10;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t round = 0; round < rounds; ++round) {
+        std::vector<PooledResource<int>> handles;
+        handles.reserve(batch);
+        for (std::size_t i = 0; i < batch; ++i) {
+            handles.push_back(pool->acquire().value());
+        }
+        std::thread([handles = std::move(handles)]() mutable { handles.clear(); }).join();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    auto ns = std::chrono::duration<double, std::nano>(elapsed).count() /
+              static_cast<double>(rounds * batch);
+    std::printf("%-48s %10.2f ns/op\n", name, ns);
+    return ns;
+}
+
+} // namespace
+
+auto main() -> int {
+    auto factory = []() { return Result<int>::ok(1); };
+    auto config =
+        default_config.with_min_size(1).with_max_size(batch).with_validation(false, false);
+
+    auto shared = PoolFactory::create_thread_safe<int>(factory, config).value();
+    auto local = PoolFactory::create_thread_local<int>(factory, config).value();
+
+    bench::section("same-thread with_resource");
+    auto shared_ns = bench::run("ThreadSafePool<int>", iterations, [&] {
+        bench::do_not_optimize(shared->with_resource(work));
+    });
+    auto local_ns = bench::run("ThreadLocalPool<int>", iterations, [&] {
+        bench::do_not_optimize(local->with_resource(work));
+    });
+    std::printf("speedup: %.2fx\n", shared_ns / local_ns);
+
+    unsigned threads = std::max(2U, std::thread::hardware_concurrency());
+    bench::section("contended with_resource");
+    std::printf("%u thread(s)\n", threads);
+    shared_ns = contended("ThreadSafePool<int>", shared, threads);
+    local_ns = contended("ThreadLocalPool<int>", local, threads);
+    std::printf("speedup: %.2fx\n", shared_ns / local_ns);
+
+    bench::section("acquire here, release on another thread (incl. thread start)");
+    shared_ns = remote_release("ThreadSafePool<int>", shared);
+    local_ns = remote_release("ThreadLocalPool<int> (remote-free stack)", local);
+    std::printf("ratio: %.2fx\n", shared_ns / local_ns);
+
+    return 0;
+}
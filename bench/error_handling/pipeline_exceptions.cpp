@@ -0,0 +1,55 @@
+#include <exception>
+
+#include "pipelines.hpp"
+
+namespace poolfactory::bench {
+
+namespace {
+
+struct ParseError : std::exception {
+    explicit ParseError(ParseErrc c) : code(c) {}
+
+    [[nodiscard]] auto what() const noexcept -> const char* override { return "parse error"; }
+
+    ParseErrc code;
+};
+
+auto parse(std::string_view input) -> int {
+    if (input.empty()) {
+        throw ParseError(ParseErrc::empty);
+    }
+    int value = 0;
+    for (char c : input) {
+        if (c < '0' || c > '9') {
+            throw ParseError(ParseErrc::invalid_digit);
+        }
+        value = value * 10 + (c - '0');
+    }
+    return value;
+}
+
+auto check_range(int value) -> int {
+    if (value > 100'000) {
+        throw ParseError(ParseErrc::out_of_range);
+    }
+    return value;
+}
+
+auto normalize(int value) -> int {
+    if (value % 1000 == 999) {
+        throw ParseError(ParseErrc::rejected);
+    }
+    return value % 1000;
+}
+
+} // namespace
+
+auto exception_pipeline(std::string_view input) -> int {
+    try {
+        return normalize(check_range(parse(input))) * 3 + 1;
+    } catch (const ParseError& e) {
+        return e.code == ParseErrc::empty ? 0 : -1;
+    }
+}
+
+} // namespace poolfactory::bench
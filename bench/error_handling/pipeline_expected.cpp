@@ -0,0 +1,84 @@
+#include "pipelines.hpp"
+
+#if __has_include(<expected>)
+#include <expected>
+#endif
+
+namespace poolfactory::bench {
+
+#if defined(__cpp_lib_expected)
+
+const bool has_expected = true;
+
+namespace {
+
+using Parsed = std::expected<int, ParseErrc>;
+
+auto parse(std::string_view input) -> Parsed {
+    if (input.empty()) {
+        return std::unexpected(ParseErrc::empty);
+    }
+    int value = 0;
+    for (char c : input) {
+        if (c < '0' || c > '9') {
+            return std::unexpected(ParseErrc::invalid_digit);
+        }
+        value = value * 10 + (c - '0');
+    }
+    return value;
+}
+
+auto check_range(int value) -> Parsed {
+    if (value > 100'000) {
+        return std::unexpected(ParseErrc::out_of_range);
+    }
+    return value;
+}
+
+auto normalize(int value) -> Parsed {
+    if (value % 1000 == 999) {
+        return std::unexpected(ParseErrc::rejected);
+    }
+    return value % 1000;
+}
+
+} // namespace
+
+auto expected_pipeline(std::string_view input) -> int {
+#if __cpp_lib_expected >= 202211L
+    return parse(input)
+        .and_then(check_range)
+        .and_then(normalize)
+        .transform([](int value) { return value * 3 + 1; })
+        .or_else([](ParseErrc e) -> Parsed {
+            if (e == ParseErrc::empty) {
+                return 0;
+            }
+            return std::unexpected(e);
+        })
+        .value_or(-1);
+#else
+    // Monadic operations arrived in a later revision (P2505); propagate by hand
+    auto parsed = parse(input);
+    if (parsed) {
+        parsed = check_range(*parsed);
+    }
+    if (parsed) {
+        parsed = normalize(*parsed);
+    }
+    if (parsed) {
+        return *parsed * 3 + 1;
+    }
+    return parsed.error() == ParseErrc::empty ? 0 : -1;
+#endif
+}
+
+#else
+
+const bool has_expected = false;
+
+auto expected_pipeline(std::string_view) -> int { return -1; }
+
+#endif
+
+} // namespace poolfactory::bench
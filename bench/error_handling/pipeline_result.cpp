@@ -0,0 +1,51 @@
+#include "pipelines.hpp"
+#include "poolfactory/result.hpp"
+
+namespace poolfactory::bench {
+
+namespace {
+
+using Parsed = Result<int, ParseErrc>;
+
+auto parse(std::string_view input) -> Parsed {
+    if (input.empty()) {
+        return Parsed::err(ParseErrc::empty);
+    }
+    int value = 0;
+    for (char c : input) {
+        if (c < '0' || c > '9') {
+            return Parsed::err(ParseErrc::invalid_digit);
+        }
+        value = value * 10 + (c - '0');
+    }
+    return Parsed::ok(value);
+}
+
+auto check_range(int value) -> Parsed {
+    if (value > 100'000) {
+        return Parsed::err(ParseErrc::out_of_range);
+    }
+    return Parsed::ok(value);
+}
+
+auto normalize(int value) -> Parsed {
+    if (value % 1000 == 999) {
+        return Parsed::err(ParseErrc::rejected);
+    }
+    return Parsed::ok(value % 1000);
+}
+
+} // namespace
+
+auto result_pipeline(std::string_view input) -> int {
+    return parse(input)
+        .and_then(check_range)
+        .and_then(normalize)
+        .map([](int value) { return value * 3 + 1; })
+        .or_else([](ParseErrc e) {
+            return e == ParseErrc::empty ? Parsed::ok(0) : Parsed::err(e);
+        })
+        .value_or(-1);
+}
+
+} // namespace poolfactory::bench
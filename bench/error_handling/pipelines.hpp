@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace poolfactory::bench {
+
+/**
+ * @brief Failures the comparison pipelines can report
+ */
+enum class ParseErrc : std::uint8_t { empty, invalid_digit, out_of_range, rejected };
+
+// The same three-stage pipeline (parse -> range check -> normalize -> scale),
+// one translation unit per error-handling strategy so their code size can be
+// compared. Each returns the scaled value, 0 for empty input, -1 on failure.
+
+auto result_pipeline(std::string_view input) -> int;
+auto exception_pipeline(std::string_view input) -> int;
+auto expected_pipeline(std::string_view input) -> int;
+
+// False when the standard library has no std::expected (pre-C++23)
+extern const bool has_expected;
+
+} // namespace poolfactory::bench
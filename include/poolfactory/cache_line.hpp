@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace poolfactory {
+
+/**
+ * @brief Alignment used to keep independently written data on separate lines
+ *
+ * Defaults to std::hardware_destructive_interference_size. Its value may
+ * change with -mtune, which changes pool layouts; define
+ * POOLFACTORY_CACHE_LINE_SIZE to pin it when pools cross an ABI boundary.
+ */
+#if defined(POOLFACTORY_CACHE_LINE_SIZE)
+inline constexpr std::size_t cache_line_size = POOLFACTORY_CACHE_LINE_SIZE;
+#elif defined(__cpp_lib_hardware_interference_size)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+inline constexpr std::size_t cache_line_size = std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#else
+inline constexpr std::size_t cache_line_size = 64;
+#endif
+
+} // namespace poolfactory
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <concepts>
+#include <cstddef>
 #include <functional>
 #include <type_traits>
 
+#include "poolfactory/emplacer.hpp"
 #include "poolfactory/result.hpp"
 #include "poolfactory/unit.hpp"
 
@@ -23,6 +25,17 @@ concept ResourceFactory = std::invocable<F> && requires(F f) {
     { f() } -> std::same_as<Result<T>>;
 };
 
+/**
+ * @brief Emplacing factory: (Emplacer<T>&) -> Result<Unit>
+ *
+ * Constructs T in place via Emplacer::emplace; returning Ok without having
+ * emplaced is treated as a factory failure.
+ */
+template <typename F, typename T>
+concept ResourceEmplacer = std::invocable<F, Emplacer<T>&> && requires(F f, Emplacer<T>& e) {
+    { f(e) } -> std::same_as<Result<Unit>>;
+};
+
 /**
  * @brief Validator function: (const T&) -> bool
  */
@@ -39,6 +52,23 @@ concept ResourceResetter = std::invocable<F, T&> && requires(F f, T& r) {
     { f(r) } -> std::same_as<Result<Unit>>;
 };
 
+/**
+ * @brief Weigher function: (const T&) -> size_t, the resource's cost (bytes, units)
+ */
+template <typename F, typename T>
+concept ResourceWeigher = std::invocable<F, const T&> && requires(F f, const T& r) {
+    { f(r) } -> std::convertible_to<std::size_t>;
+};
+
+/**
+ * @brief Tagger function: (const T&) -> Tag, a hashable key of the resource's state
+ */
+template <typename F, typename T>
+concept ResourceTagger = std::invocable<F, const T&> && requires(F f, const T& r) {
+    { std::hash<std::decay_t<decltype(f(r))>>{}(f(r)) } -> std::convertible_to<std::size_t>;
+    requires std::equality_comparable<std::decay_t<decltype(f(r))>>;
+};
+
 /**
  * @brief Destroyer function: (T&) -> void
  */
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <concepts>
+#include <new>
+#include <utility>
+
+namespace poolfactory {
+
+/**
+ * @brief Constructs a resource directly into pool-owned storage
+ *
+ * Handed to an emplacing factory instead of asking it to return T by value:
+ * the factory does whatever fallible setup it needs, then calls emplace()
+ * once with T's constructor arguments. T is never moved, so it need not
+ * even be movable. Calling emplace() twice is a precondition violation.
+ *
+ * Only StaticPool takes emplacing factories: Pool and ThreadSafePool move
+ * resources in and out of handles, so building in place would save nothing.
+ */
+template <typename T> class Emplacer {
+  public:
+    explicit Emplacer(void* storage) noexcept : storage_(storage) {}
+
+    Emplacer(const Emplacer&) = delete;
+    auto operator=(const Emplacer&) -> Emplacer& = delete;
+
+    template <typename... Args>
+        requires std::constructible_from<T, Args...>
+    auto emplace(Args&&... args) -> T& {
+        T* object = ::new (storage_) T(std::forward<Args>(args)...);
+        constructed_ = true;
+        return *object;
+    }
+
+    [[nodiscard]] auto constructed() const noexcept -> bool { return constructed_; }
+
+  private:
+    void* storage_;
+    bool constructed_{false};
+};
+
+} // namespace poolfactory
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+#include "poolfactory/pool_error.hpp"
+#include "poolfactory/result.hpp"
+
+namespace poolfactory::detail {
+
+/**
+ * @brief Owned non-blocking eventfd
+ *
+ * A kernel counter that polls readable while it is non-zero, so epoll,
+ * libuv-style or io_uring loops can wait on it next to their sockets.
+ * Linux only; elsewhere create() fails.
+ */
+class EventFd {
+  public:
+    [[nodiscard]] static auto create() -> PoolResult<EventFd> {
+#if defined(__linux__)
+        int fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (fd < 0) {
+            return PoolResult<EventFd>::err(
+                {PoolErrc::invalid_config, std::string("eventfd: ") + std::strerror(errno)});
+        }
+        return PoolResult<EventFd>::ok(EventFd(fd));
+#else
+        return PoolResult<EventFd>::err({PoolErrc::invalid_config, "eventfd requires Linux"});
+#endif
+    }
+
+    EventFd(const EventFd&) = delete;
+    auto operator=(const EventFd&) -> EventFd& = delete;
+    EventFd(EventFd&& other) noexcept : fd_(std::exchange(other.fd_, -1)) {}
+    auto operator=(EventFd&&) -> EventFd& = delete;
+
+    ~EventFd() {
+#if defined(__linux__)
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+#endif
+    }
+
+    [[nodiscard]] auto fd() const -> int { return fd_; }
+
+    // Add n to the counter (makes the fd readable)
+    void signal([[maybe_unused]] std::uint64_t n) const {
+#if defined(__linux__)
+        // Cannot fail short of counter overflow (2^64 - 2 pending signals)
+        [[maybe_unused]] auto written = ::write(fd_, &n, sizeof(n));
+#endif
+    }
+
+    // Read and reset the counter; 0 when nothing was signalled
+    auto drain() const -> std::uint64_t {
+        std::uint64_t count = 0;
+#if defined(__linux__)
+        if (::read(fd_, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) {
+            return 0; // EAGAIN: not readable
+        }
+#endif
+        return count;
+    }
+
+  private:
+    explicit EventFd(int fd) : fd_(fd) {}
+
+    int fd_;
+};
+
+} // namespace poolfactory::detail
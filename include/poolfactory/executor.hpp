@@ -0,0 +1,105 @@
+#pragma once
+
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace poolfactory {
+
+/**
+ * @brief Anything that can run a void() task, now or later, on some thread
+ *
+ * Only `execute` is required, so an application's own thread pool can be
+ * passed to when_all/traverse directly.
+ */
+template <typename Ex>
+concept Executor = requires(Ex& ex, std::function<void()> task) { ex.execute(std::move(task)); };
+
+/**
+ * @brief Runs each task immediately on the calling thread
+ *
+ * With when_all this degenerates to sequential evaluation that stops at the
+ * first error.
+ */
+struct InlineExecutor {
+    template <std::invocable F> void execute(F&& task) const { std::forward<F>(task)(); }
+};
+
+/**
+ * @brief True for executors that run every task on the calling thread
+ *
+ * APIs that need tasks to run concurrently (hedged_acquire) reject these.
+ * Specialize it for an application's own inline executor.
+ */
+template <typename Ex> inline constexpr bool runs_inline = false;
+
+template <> inline constexpr bool runs_inline<InlineExecutor> = true;
+
+/**
+ * @brief Fixed set of worker threads draining a shared FIFO of tasks
+ *
+ * Workers are started in the constructor and joined in the destructor after
+ * the queue has been drained. A task must not block waiting on other tasks
+ * of the same executor (e.g. a nested when_all) once every worker is busy.
+ */
+class ThreadPoolExecutor {
+  public:
+    explicit ThreadPoolExecutor(std::size_t threads = std::thread::hardware_concurrency()) {
+        threads = threads == 0 ? 1 : threads;
+        workers_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers_.emplace_back([this](std::stop_token token) { work(token); });
+        }
+    }
+
+    ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+    auto operator=(const ThreadPoolExecutor&) -> ThreadPoolExecutor& = delete;
+    ThreadPoolExecutor(ThreadPoolExecutor&&) = delete;
+    auto operator=(ThreadPoolExecutor&&) -> ThreadPoolExecutor& = delete;
+
+    ~ThreadPoolExecutor() {
+        for (auto& worker : workers_) {
+            worker.request_stop();
+        }
+        // jthread destructors join; workers finish queued tasks first
+    }
+
+    void execute(std::function<void()> task) {
+        {
+            std::lock_guard lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+    [[nodiscard]] auto size() const -> std::size_t { return workers_.size(); }
+
+  private:
+    void work(std::stop_token token) {
+        std::unique_lock lock(mutex_);
+        while (true) {
+            if (!cv_.wait(lock, token, [this] { return !tasks_.empty(); })) {
+                return; // stop requested and nothing left to run
+            }
+            auto task = std::move(tasks_.front());
+            tasks_.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable_any cv_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::jthread> workers_; // last: joined before the queue dies
+};
+
+} // namespace poolfactory
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace poolfactory::detail {
+
+/**
+ * @brief Per-thread xorshift32: cheap random picks without a shared generator
+ *
+ * Not for anything but load spreading.
+ */
+inline auto fast_random() -> std::uint32_t {
+    thread_local std::uint32_t state = [] {
+        auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+        auto seed = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&state) ^
+                                               static_cast<std::uintptr_t>(now));
+        return seed == 0 ? 0x9E3779B9U : seed;
+    }();
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+} // namespace poolfactory::detail
@@ -0,0 +1,346 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "poolfactory/cache_line.hpp"
+#include "poolfactory/concepts.hpp"
+#include "poolfactory/fast_random.hpp"
+#include "poolfactory/pool.hpp"
+#include "poolfactory/pool_config.hpp"
+#include "poolfactory/pool_error.hpp"
+#include "poolfactory/result.hpp"
+#include "poolfactory/unit.hpp"
+
+namespace poolfactory {
+
+// Forward declarations
+class PoolFactory;
+template <Poolable T> class LatencyAwarePool;
+
+/**
+ * @brief How LatencyAwarePool scores, picks and retires resources
+ */
+struct LatencyScoring {
+    enum class Selection {
+        least_ewma,   // scan idle resources, take the lowest EWMA
+        power_of_two, // compare two random idle resources (O(1))
+    };
+
+    Selection selection{Selection::least_ewma};
+    double alpha{0.2};               // EWMA weight of the newest sample
+    double straggler_factor{4.0};    // retire above factor x pool EWMA (0: never)
+    std::uint32_t warmup_samples{8}; // samples before a resource can be retired
+
+    constexpr auto operator==(const LatencyScoring&) const -> bool = default;
+};
+
+/**
+ * @brief LatencyAwarePool statistics
+ */
+struct LatencyStats {
+    PoolStats pool;
+    std::chrono::nanoseconds mean_latency; // EWMA over every sample
+    std::size_t retired;                   // resources dropped as stragglers
+
+    constexpr auto operator==(const LatencyStats&) const -> bool = default;
+};
+
+/**
+ * @brief RAII handle from LatencyAwarePool
+ *
+ * Measures how long it is held; report() replaces that sample with a
+ * latency measured by the caller (e.g. a server round trip).
+ */
+template <Poolable T> class ScoredResource {
+  public:
+    ScoredResource(const ScoredResource&) = delete;
+    auto operator=(const ScoredResource&) -> ScoredResource& = delete;
+
+    ScoredResource(ScoredResource&& other) noexcept
+        : pool_(std::exchange(other.pool_, nullptr)), resource_(std::move(other.resource_)),
+          score_(other.score_), start_(other.start_), reported_(other.reported_) {}
+
+    auto operator=(ScoredResource&& other) noexcept -> ScoredResource& {
+        if (this != &other) {
+            release();
+            pool_ = std::exchange(other.pool_, nullptr);
+            resource_ = std::move(other.resource_);
+            score_ = other.score_;
+            start_ = other.start_;
+            reported_ = other.reported_;
+        }
+        return *this;
+    }
+
+    ~ScoredResource() { release(); }
+
+    [[nodiscard]] auto get() const -> const T& { return *resource_; }
+    [[nodiscard]] auto get() -> T& { return *resource_; }
+
+    auto operator->() -> T* { return &(*resource_); }
+    auto operator->() const -> const T* { return &(*resource_); }
+    auto operator*() -> T& { return *resource_; }
+    auto operator*() const -> const T& { return *resource_; }
+
+    [[nodiscard]] auto has_value() const -> bool { return pool_ != nullptr; }
+    explicit operator bool() const { return has_value(); }
+
+    /**
+     * @brief Score this use with a caller-measured latency instead of hold time
+     */
+    void report(std::chrono::nanoseconds latency) { reported_ = latency; }
+
+  private:
+    friend class LatencyAwarePool<T>;
+
+    struct Score {
+        double ewma_ns;
+        std::uint32_t samples;
+    };
+
+    ScoredResource(LatencyAwarePool<T>* pool, T resource, Score score)
+        : pool_(pool), resource_(std::move(resource)), score_(score),
+          start_(std::chrono::steady_clock::now()) {}
+
+    void release() {
+        if (pool_ != nullptr) {
+            auto latency = reported_.value_or(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start_));
+            std::exchange(pool_, nullptr)->release_scored(std::move(*resource_), score_, latency);
+            resource_.reset();
+        }
+    }
+
+    LatencyAwarePool<T>* pool_;
+    std::optional<T> resource_;
+    Score score_;
+    std::chrono::steady_clock::time_point start_;
+    std::optional<std::chrono::nanoseconds> reported_;
+};
+
+/**
+ * @brief Thread-safe pool that lends its fastest idle resources first
+ *
+ * Every idle resource carries an EWMA of its latency: by default the time
+ * each borrower held it, or what the borrower passed to
+ * ScoredResource::report(). Acquire picks the idle resource with the lowest
+ * EWMA (or the better of two random ones); a fresh resource scores 0, so it
+ * is tried early. A resource whose EWMA exceeds straggler_factor times the
+ * pool-wide EWMA after warmup_samples uses is destroyed on release instead
+ * of returning to the pool; a new one is created on demand.
+ */
+template <Poolable T> class LatencyAwarePool {
+    using Score = typename ScoredResource<T>::Score;
+
+  public:
+    using Factory = std::function<Result<T>()>;
+    using Validator = std::function<bool(const T&)>;
+    using Resetter = std::function<Result<Unit>(T&)>;
+
+    LatencyAwarePool(const LatencyAwarePool&) = delete;
+    auto operator=(const LatencyAwarePool&) -> LatencyAwarePool& = delete;
+    LatencyAwarePool(LatencyAwarePool&&) = delete;
+    auto operator=(LatencyAwarePool&&) -> LatencyAwarePool& = delete;
+
+    ~LatencyAwarePool() = default;
+
+    /**
+     * @brief Acquire the best-scoring resource, blocking until available or timeout
+     */
+    [[nodiscard]] auto acquire() -> PoolResult<ScoredResource<T>> {
+        auto acquired = acquire_scored();
+        if (acquired.is_err()) {
+            return PoolResult<ScoredResource<T>>::err(std::move(acquired).error());
+        }
+        auto [resource, score] = std::move(acquired).value();
+        return PoolResult<ScoredResource<T>>::ok(
+            ScoredResource<T>(this, std::move(resource), score));
+    }
+
+    /**
+     * @brief Execute function with a pooled resource, scored by hold time
+     */
+    template <typename F>
+    auto with_resource(F&& f)
+        -> PoolResult<std::conditional_t<std::is_void_v<std::invoke_result_t<F, T&>>,
+                                         Unit,
+                                         std::invoke_result_t<F, T&>>> {
+        using RawR = std::invoke_result_t<F, T&>;
+        using R = std::conditional_t<std::is_void_v<RawR>, Unit, RawR>;
+
+        auto acquired = acquire();
+        if (acquired.is_err()) {
+            return PoolResult<R>::err(std::move(acquired).error());
+        }
+
+        auto handle = std::move(acquired).value();
+        if constexpr (std::is_void_v<RawR>) {
+            f(*handle);
+            return PoolResult<R>::ok(unit);
+        } else {
+            return PoolResult<R>::ok(f(*handle));
+        }
+    }
+
+    [[nodiscard]] auto stats() const -> LatencyStats {
+        std::lock_guard lock(mutex_);
+        return LatencyStats{
+            .pool =
+                PoolStats{
+                    .available = idle_.size(),
+                    .in_use = in_use_,
+                    .total_created = total_created_,
+                    .max_size = config_.max_size,
+                },
+            .mean_latency = std::chrono::nanoseconds(static_cast<std::int64_t>(pool_ewma_ns_)),
+            .retired = retired_,
+        };
+    }
+
+    [[nodiscard]] auto config() const -> const PoolConfig& { return config_; }
+
+    [[nodiscard]] auto scoring() const -> const LatencyScoring& { return scoring_; }
+
+  private:
+    friend class PoolFactory;
+    friend class ScoredResource<T>;
+
+    struct Idle {
+        T resource;
+        Score score;
+    };
+
+    LatencyAwarePool(Factory factory,
+                     Validator validator,
+                     Resetter resetter,
+                     PoolConfig config,
+                     LatencyScoring scoring)
+        : factory_(std::move(factory)), validator_(std::move(validator)),
+          resetter_(std::move(resetter)), config_(config), scoring_(scoring) {
+        idle_.reserve(config_.max_size);
+        // Pre-warm pool to min_size
+        for (std::size_t i = 0; i < config_.min_size; ++i) {
+            auto result = factory_();
+            if (result.is_ok()) {
+                idle_.push_back(Idle{std::move(result).value(), Score{0.0, 0}});
+                ++total_created_;
+            }
+        }
+    }
+
+    auto acquire_scored() -> PoolResult<std::pair<T, Score>> {
+        std::unique_lock lock(mutex_);
+
+        // Wait for available resource or room to create new one
+        if (idle_.empty() && in_use_ >= config_.max_size) {
+            auto deadline = std::chrono::steady_clock::now() + config_.acquire_timeout;
+            auto ready = [this] { return !idle_.empty() || in_use_ < config_.max_size; };
+            if (!cv_.wait_until(lock, deadline, ready)) {
+                return PoolResult<std::pair<T, Score>>::err(PoolErrc::timeout);
+            }
+        }
+
+        while (!idle_.empty()) {
+            Idle picked = take_best();
+            if (config_.validate_on_acquire && validator_ && !validator_(picked.resource)) {
+                continue; // invalid: drop it and try the next best
+            }
+            ++in_use_;
+            return PoolResult<std::pair<T, Score>>::ok({std::move(picked.resource), picked.score});
+        }
+
+        auto result = factory_();
+        if (result.is_err()) {
+            return PoolResult<std::pair<T, Score>>::err(
+                PoolError(PoolErrc::factory_failed, std::move(result).error()));
+        }
+        ++total_created_;
+        ++in_use_;
+        return PoolResult<std::pair<T, Score>>::ok({std::move(result).value(), Score{0.0, 0}});
+    }
+
+    // Caller holds mutex_ and idle_ is not empty
+    auto take_best() -> Idle {
+        std::size_t best = 0;
+        if (scoring_.selection == LatencyScoring::Selection::power_of_two) {
+            auto a = detail::fast_random() % idle_.size();
+            auto b = detail::fast_random() % idle_.size();
+            best = idle_[a].score.ewma_ns <= idle_[b].score.ewma_ns ? a : b;
+        } else {
+            for (std::size_t i = 1; i < idle_.size(); ++i) {
+                if (idle_[i].score.ewma_ns < idle_[best].score.ewma_ns) {
+                    best = i;
+                }
+            }
+        }
+        Idle picked = std::move(idle_[best]);
+        if (best + 1 != idle_.size()) {
+            idle_[best] = std::move(idle_.back());
+        }
+        idle_.pop_back();
+        return picked;
+    }
+
+    void release_scored(T resource, Score score, std::chrono::nanoseconds latency) {
+        auto sample = static_cast<double>(latency.count());
+        score.ewma_ns = score.samples == 0
+                            ? sample
+                            : scoring_.alpha * sample + (1.0 - scoring_.alpha) * score.ewma_ns;
+        ++score.samples;
+
+        {
+            std::lock_guard lock(mutex_);
+            --in_use_;
+            pool_ewma_ns_ = total_samples_++ == 0 ? sample
+                                                  : scoring_.alpha * sample +
+                                                        (1.0 - scoring_.alpha) * pool_ewma_ns_;
+
+            if (is_straggler(score)) {
+                ++retired_;
+            } else if (recycle(resource)) {
+                idle_.push_back(Idle{std::move(resource), score});
+            }
+        }
+        cv_.notify_one();
+    }
+
+    auto is_straggler(const Score& score) const -> bool {
+        return scoring_.straggler_factor > 0.0 && score.samples >= scoring_.warmup_samples &&
+               score.ewma_ns > scoring_.straggler_factor * pool_ewma_ns_;
+    }
+
+    // Reset and validate a released resource; false means discard it
+    auto recycle(T& resource) -> bool {
+        if (resetter_ && resetter_(resource).is_err()) {
+            return false;
+        }
+        return !(config_.validate_on_release && validator_ && !validator_(resource));
+    }
+
+    Factory factory_;
+    Validator validator_;
+    Resetter resetter_;
+    PoolConfig config_;
+    LatencyScoring scoring_;
+
+    // Everything below is guarded by mutex_
+    alignas(cache_line_size) mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<Idle> idle_;
+    std::size_t in_use_{0};
+    std::size_t total_created_{0};
+    std::size_t retired_{0};
+    std::uint64_t total_samples_{0};
+    double pool_ewma_ns_{0.0};
+};
+
+} // namespace poolfactory
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "poolfactory/executor.hpp"
+#include "poolfactory/pool_error.hpp"
+#include "poolfactory/result.hpp"
+#include "poolfactory/unit.hpp"
+
+namespace poolfactory {
+
+namespace detail {
+
+// Handle type returned by pool.acquire() (PooledResource, SharedLease, ...)
+template <typename PoolT>
+using HandleOf = std::remove_cvref_t<decltype(std::declval<PoolT&>().acquire().value())>;
+
+template <typename PoolT> using ResourceOf = decltype(*std::declval<HandleOf<PoolT>&>());
+
+template <std::size_t I, typename PoolT, typename Handles>
+void acquire_into(PoolT& pool, Handles& handles, std::optional<PoolError>& error) {
+    auto result = pool.acquire();
+    if (result.is_ok()) {
+        std::get<I>(handles).emplace(std::move(result).value());
+    } else {
+        error = std::move(result).error();
+    }
+}
+
+template <typename... Pools, std::size_t... I>
+auto acquire_all_impl(std::index_sequence<I...> /*indices*/, Pools&... pools)
+    -> PoolResult<std::tuple<HandleOf<Pools>...>> {
+    constexpr std::size_t n = sizeof...(Pools);
+
+    // One global order (by pool address) for every caller: two transactions
+    // can never each hold what the other waits for
+    std::array<const void*, n> addresses{static_cast<const void*>(std::addressof(pools))...};
+    std::array<std::size_t, n> order{I...};
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return std::less<const void*>{}(addresses[a], addresses[b]);
+    });
+
+    std::tuple<std::optional<HandleOf<Pools>>...> handles;
+    std::optional<PoolError> error;
+    std::size_t acquired = 0;
+
+    for (; acquired < n && !error; ++acquired) {
+        // Runtime index -> pool: exactly one fold term matches
+        auto index = order[acquired];
+        ((index == I ? acquire_into<I>(pools, handles, error) : void()), ...);
+    }
+
+    if (error) {
+        // All or nothing: return what was taken, most recent first
+        while (acquired-- > 0) {
+            auto index = order[acquired];
+            ((index == I ? std::get<I>(handles).reset() : void()), ...);
+        }
+        return PoolResult<std::tuple<HandleOf<Pools>...>>::err(std::move(*error));
+    }
+    return PoolResult<std::tuple<HandleOf<Pools>...>>::ok(
+        std::tuple<HandleOf<Pools>...>(std::move(*std::get<I>(handles))...));
+}
+
+template <typename Tuple, std::size_t... I>
+auto with_resources_impl(std::index_sequence<I...> /*indices*/, Tuple args) {
+    constexpr std::size_t last = std::tuple_size_v<Tuple> - 1;
+    auto&& f = std::get<last>(args);
+
+    using RawR = std::invoke_result_t<decltype(f), ResourceOf<std::tuple_element_t<I, Tuple>>...>;
+    using R = std::conditional_t<std::is_void_v<RawR>, Unit, RawR>;
+
+    auto acquired = acquire_all_impl(std::index_sequence<I...>{}, std::get<I>(args)...);
+    if (acquired.is_err()) {
+        return PoolResult<R>::err(std::move(acquired).error());
+    }
+
+    auto handles = std::move(acquired).value();
+    if constexpr (std::is_void_v<RawR>) {
+        f(*std::get<I>(handles)...);
+        return PoolResult<R>::ok(unit);
+    } else {
+        return PoolResult<R>::ok(f(*std::get<I>(handles)...));
+    }
+}
+
+/**
+ * @brief Outcome of one hedged_acquire call, shared with its attempts
+ *
+ * Heap-allocated: an attempt may still be blocked in acquire() after the
+ * caller returned with another pool's resource. Whatever arrives once a
+ * winner exists is released right away.
+ */
+template <typename Handle> class HedgeState {
+  public:
+    void start() {
+        std::lock_guard lock(mutex_);
+        ++running_;
+    }
+
+    // Run an attempt unless a winner arrived while it was queued
+    template <typename Attempt> void run(Attempt& attempt) {
+        {
+            std::lock_guard lock(mutex_);
+            if (winner_ || settled_) {
+                --running_;
+                return;
+            }
+        }
+        complete(attempt());
+    }
+
+    void complete(PoolResult<Handle> result) {
+        std::optional<Handle> loser; // released after unlocking
+        {
+            std::lock_guard lock(mutex_);
+            --running_;
+            if (result.is_err()) {
+                error_ = std::move(result).error();
+            } else if (winner_ || settled_) {
+                loser.emplace(std::move(result).value());
+            } else {
+                winner_.emplace(std::move(result).value());
+            }
+        }
+        cv_.notify_all();
+    }
+
+    // Wait up to delay for a winner; false means start the next pool
+    auto wait_for(std::chrono::milliseconds delay) -> bool {
+        std::unique_lock lock(mutex_);
+        cv_.wait_for(lock, delay, [this] { return winner_ || running_ == 0; });
+        return winner_.has_value();
+    }
+
+    // Wait for a winner or for every attempt to fail
+    auto settle() -> PoolResult<Handle> {
+        std::unique_lock lock(mutex_);
+        cv_.wait(lock, [this] { return winner_ || running_ == 0; });
+        settled_ = true;
+        if (winner_) {
+            return PoolResult<Handle>::ok(std::move(*std::exchange(winner_, std::nullopt)));
+        }
+        return PoolResult<Handle>::err(std::move(*error_));
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::size_t running_{0};
+    bool settled_{false};
+    std::optional<Handle> winner_;
+    std::optional<PoolError> error_; // most recent failure
+};
+
+} // namespace detail
+
+/**
+ * @brief Acquire one resource from each pool, all or nothing
+ *
+ * Pools are acquired in a global order (by address), not argument order,
+ * so concurrent callers naming the same pools in any order cannot
+ * deadlock. If any acquire fails (timeout, factory error), the handles
+ * already taken are released at once and that error is returned; nothing
+ * is held while the caller handles it.
+ *
+ * Works with any pool whose acquire() returns a handle (Pool,
+ * ThreadSafePool, ThreadLocalPool, NumaPool, SharedLeasePool,
+ * LatencyAwarePool, StaticPool).
+ */
+template <typename... Pools>
+    requires(sizeof...(Pools) > 0)
+[[nodiscard]] auto acquire_all(Pools&... pools)
+    -> PoolResult<std::tuple<detail::HandleOf<Pools>...>> {
+    return detail::acquire_all_impl(std::index_sequence_for<Pools...>{}, pools...);
+}
+
+/**
+ * @brief Run f with one resource from each pool (multi-pool bracket)
+ *
+ * with_resources(db, cache, [](Conn& c, Cache& k) { ... }): acquires as
+ * acquire_all() does, calls f with every resource, then releases them
+ * all. Returns PoolResult of f's result (Unit for void).
+ */
+template <typename... Args>
+    requires(sizeof...(Args) > 1)
+auto with_resources(Args&&... args) {
+    return detail::with_resources_impl(std::make_index_sequence<sizeof...(Args) - 1>{},
+                                       std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+/**
+ * @brief Acquire from the first pool to deliver, hedging after a delay
+ *
+ * Pools are listed in order of preference (primary first). Each attempt
+ * runs on the executor; the next pool is tried hedge_delay after the
+ * previous one started, or at once when every running attempt failed.
+ * The first resource to arrive is returned and any later one goes straight
+ * back to its pool, so each pool's own limits always hold. Fails with the
+ * last error only when every pool failed.
+ *
+ * Each attempt blocks a worker in acquire(), for up to its pool's
+ * acquire_timeout, so the executor needs a free worker per pool: with
+ * every worker busy a hedge only starts once one frees up. Inline
+ * executors are rejected. An attempt still queued when a winner arrives
+ * is skipped; one already blocked keeps its worker until acquire()
+ * returns, and keeps its pool alive (hence shared_ptr) past this call.
+ * All pools must hand out the same handle type.
+ */
+template <Executor Ex, typename Primary, typename... Fallbacks>
+    requires(!runs_inline<std::remove_cv_t<Ex>>) && (sizeof...(Fallbacks) > 0) &&
+            (std::same_as<detail::HandleOf<Primary>, detail::HandleOf<Fallbacks>> && ...)
+[[nodiscard]] auto hedged_acquire(Ex& executor,
+                                  std::chrono::milliseconds hedge_delay,
+                                  std::shared_ptr<Primary> primary,
+                                  std::shared_ptr<Fallbacks>... fallbacks)
+    -> PoolResult<detail::HandleOf<Primary>> {
+    using Handle = detail::HandleOf<Primary>;
+    using Attempt = std::function<PoolResult<Handle>()>;
+
+    std::array<Attempt, 1 + sizeof...(Fallbacks)> attempts{
+        [pool = std::move(primary)] { return pool->acquire(); },
+        [pool = std::move(fallbacks)] { return pool->acquire(); }...};
+
+    auto state = std::make_shared<detail::HedgeState<Handle>>();
+    for (std::size_t i = 0; i < attempts.size(); ++i) {
+        state->start();
+        executor.execute([state, attempt = std::move(attempts[i])] { state->run(attempt); });
+        if (i + 1 < attempts.size() && state->wait_for(hedge_delay)) {
+            break; // won before the next hedge was due
+        }
+    }
+    return state->settle();
+}
+
+} // namespace poolfactory
@@ -0,0 +1,275 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "poolfactory/cache_line.hpp"
+#include "poolfactory/concepts.hpp"
+#include "poolfactory/numa_topology.hpp"
+#include "poolfactory/pool.hpp"
+#include "poolfactory/pool_config.hpp"
+#include "poolfactory/pool_error.hpp"
+#include "poolfactory/result.hpp"
+#include "poolfactory/unit.hpp"
+
+namespace poolfactory {
+
+template <Poolable T> class NumaPool;
+
+/**
+ * @brief Per-node NUMA statistics
+ */
+struct NumaNodeStats {
+    PoolStats pool;          // resources owned by this node
+    std::size_t local_hits;  // acquires from this node served by this node
+    std::size_t remote_hits; // acquires from this node served by another node
+
+    constexpr auto operator==(const NumaNodeStats&) const -> bool = default;
+};
+
+/**
+ * @brief The sub-pool of one NUMA node
+ *
+ * A ThreadSafePool that can additionally lend an idle resource to another
+ * node without creating one there: resources are only ever created by
+ * threads running on their own node, so first touch places them locally.
+ */
+template <Poolable T> class NumaNodePool final : public BasicPool<NumaNodePool<T>, T> {
+    using Base = BasicPool<NumaNodePool<T>, T>;
+
+  public:
+    using typename Base::Factory;
+    using typename Base::Validator;
+    using typename Base::Resetter;
+
+    /**
+     * @brief Get sub-pool statistics (thread-safe)
+     */
+    [[nodiscard]] auto stats() const -> PoolStats {
+        std::lock_guard lock(mutex_);
+        return this->stats_unlocked();
+    }
+
+  private:
+    friend class NumaPool<T>;
+    friend Base;
+    friend class detail::ReleaseOnExit<NumaNodePool<T>, T, std::size_t>;
+
+    NumaNodePool(Factory factory, Validator validator, Resetter resetter, PoolConfig config)
+        : Base(std::move(factory), std::move(validator), std::move(resetter), config) {}
+
+    // Idle or newly created resource; exhausted instead of waiting
+    auto try_acquire_resource() -> PoolResult<T> {
+        std::lock_guard lock(mutex_);
+        return this->acquire_unlocked();
+    }
+
+    // Idle resource only: lending to a thread of another node
+    auto acquire_idle() -> PoolResult<T> {
+        std::lock_guard lock(mutex_);
+        if (this->available_.empty()) {
+            return PoolResult<T>::err(PoolErrc::exhausted);
+        }
+        return this->acquire_unlocked();
+    }
+
+    // Wait up to acquire_timeout for a release on this node
+    auto acquire_resource() -> PoolResult<T> {
+        std::unique_lock lock(mutex_);
+
+        if (!this->has_capacity_unlocked()) {
+            auto deadline = std::chrono::steady_clock::now() + this->config_.acquire_timeout;
+            auto ready = [this] { return this->has_capacity_unlocked(); };
+            if (!cv_.wait_until(lock, deadline, ready)) {
+                return PoolResult<T>::err(PoolErrc::timeout);
+            }
+        }
+
+        return this->acquire_unlocked();
+    }
+
+    void release_resource(T resource, std::size_t charged) {
+        {
+            std::lock_guard lock(mutex_);
+            this->release_unlocked(std::move(resource), charged);
+        }
+        cv_.notify_one();
+    }
+
+    alignas(cache_line_size) mutable std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+/**
+ * @brief Thread-safe pool with one sub-pool per NUMA node
+ *
+ * Acquire serves the calling thread from its own node first (creating
+ * there if the node has room), then borrows an idle resource from the other
+ * nodes, and only then waits on its own node. A resource always returns to
+ * the node that created it. The config applies per node; min_size is
+ * pre-warmed by a thread pinned to each node, so those resources are
+ * first-touched locally too. The lifecycle hooks run on many threads and
+ * must be thread-safe.
+ *
+ * Placement relies on first touch: resources whose memory is allocated in
+ * the factory (or inline in T) land on the creating thread's node.
+ */
+template <Poolable T> class NumaPool {
+  public:
+    using NodePool = NumaNodePool<T>;
+    using Factory = typename NodePool::Factory;
+    using Validator = typename NodePool::Validator;
+    using Resetter = typename NodePool::Resetter;
+
+    NumaPool(const NumaPool&) = delete;
+    auto operator=(const NumaPool&) -> NumaPool& = delete;
+    NumaPool(NumaPool&&) = delete;
+    auto operator=(NumaPool&&) -> NumaPool& = delete;
+
+    ~NumaPool() = default;
+
+    /**
+     * @brief Acquire a resource, preferring the calling thread's node
+     */
+    [[nodiscard]] auto acquire() -> PoolResult<PooledResource<T>> {
+        auto [node, acquired] = acquire_from_nodes();
+        if (acquired.is_err()) {
+            return PoolResult<PooledResource<T>>::err(std::move(acquired).error());
+        }
+        return node->wrap_resource(std::move(acquired).value());
+    }
+
+    /**
+     * @brief Execute function with a pooled resource (bracket pattern)
+     */
+    template <typename F>
+    auto with_resource(F&& f)
+        -> PoolResult<std::conditional_t<std::is_void_v<std::invoke_result_t<F, T&>>,
+                                         Unit,
+                                         std::invoke_result_t<F, T&>>> {
+        using RawR = std::invoke_result_t<F, T&>;
+        using R = std::conditional_t<std::is_void_v<RawR>, Unit, RawR>;
+
+        auto [node, acquired] = acquire_from_nodes();
+        if (acquired.is_err()) {
+            return PoolResult<R>::err(std::move(acquired).error());
+        }
+
+        T resource = std::move(acquired).value();
+        detail::ReleaseOnExit<NodePool, T, std::size_t> guard(
+            *node, resource, node->weigh(resource));
+        if constexpr (std::is_void_v<RawR>) {
+            f(resource);
+            return PoolResult<R>::ok(unit);
+        } else {
+            return PoolResult<R>::ok(f(resource));
+        }
+    }
+
+    /**
+     * @brief Totals over all nodes (each node locked in turn)
+     */
+    [[nodiscard]] auto stats() const -> PoolStats {
+        PoolStats total{};
+        for (const auto& node : nodes_) {
+            auto s = node->stats();
+            total.available += s.available;
+            total.in_use += s.in_use;
+            total.total_created += s.total_created;
+            total.max_size += s.max_size;
+        }
+        return total;
+    }
+
+    [[nodiscard]] auto node_stats(std::size_t node) const -> NumaNodeStats {
+        return NumaNodeStats{
+            .pool = nodes_[node]->stats(),
+            .local_hits = counters_[node].local_hits.load(std::memory_order_relaxed),
+            .remote_hits = counters_[node].remote_hits.load(std::memory_order_relaxed),
+        };
+    }
+
+    [[nodiscard]] auto node_count() const -> std::size_t { return nodes_.size(); }
+
+    [[nodiscard]] auto config() const -> const PoolConfig& { return config_; }
+
+  private:
+    friend class PoolFactory;
+
+    // One line per node: counters of different nodes never share a line
+    struct alignas(cache_line_size) NodeCounters {
+        std::atomic<std::size_t> local_hits{0};
+        std::atomic<std::size_t> remote_hits{0};
+    };
+
+    NumaPool(Factory factory,
+             Validator validator,
+             Resetter resetter,
+             PoolConfig config,
+             const NumaTopology& topology = NumaTopology::system())
+        : config_(config), topology_(topology), nodes_(topology.node_count()),
+          counters_(std::make_unique<NodeCounters[]>(topology.node_count())) {
+        for (std::size_t node = 0; node < nodes_.size(); ++node) {
+            auto build = [&] {
+                nodes_[node] = std::unique_ptr<NodePool>(
+                    new NodePool(factory, validator, resetter, config));
+            };
+            if (config.min_size > 0 && nodes_.size() > 1) {
+                // Pre-warm from a thread running on the node itself
+                std::thread([&] {
+                    topology_.pin_current_thread(node);
+                    build();
+                }).join();
+            } else {
+                build();
+            }
+        }
+    }
+
+    auto acquire_from_nodes() -> std::pair<NodePool*, PoolResult<T>> {
+        auto home = topology_.current_node();
+        if (home >= nodes_.size()) {
+            home = 0;
+        }
+
+        auto local = nodes_[home]->try_acquire_resource();
+        if (local.is_ok()) {
+            counters_[home].local_hits.fetch_add(1, std::memory_order_relaxed);
+            return {nodes_[home].get(), std::move(local)};
+        }
+        if (local.error() != PoolErrc::exhausted) {
+            return {nodes_[home].get(), std::move(local)};
+        }
+
+        // Home node is full: borrow an idle resource, nearest index first
+        for (std::size_t offset = 1; offset < nodes_.size(); ++offset) {
+            auto node = (home + offset) % nodes_.size();
+            auto remote = nodes_[node]->acquire_idle();
+            if (remote.is_ok()) {
+                counters_[home].remote_hits.fetch_add(1, std::memory_order_relaxed);
+                return {nodes_[node].get(), std::move(remote)};
+            }
+        }
+
+        auto waited = nodes_[home]->acquire_resource();
+        if (waited.is_ok()) {
+            counters_[home].local_hits.fetch_add(1, std::memory_order_relaxed);
+        }
+        return {nodes_[home].get(), std::move(waited)};
+    }
+
+    PoolConfig config_;
+    const NumaTopology& topology_;
+    std::vector<std::unique_ptr<NodePool>> nodes_;
+    std::unique_ptr<NodeCounters[]> counters_;
+};
+
+} // namespace poolfactory
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace poolfactory {
+
+/**
+ * @brief NUMA nodes of this machine and which CPUs belong to each
+ *
+ * Read once from /sys/devices/system/node, no libnuma needed. Nodes are
+ * numbered densely (0..node_count()-1) even when the kernel's ids have
+ * gaps. Without NUMA information (non-Linux, containers hiding sysfs) the
+ * machine is reported as a single node holding every CPU.
+ */
+class NumaTopology {
+  public:
+    [[nodiscard]] static auto system() -> const NumaTopology& {
+        static const NumaTopology topology = detect();
+        return topology;
+    }
+
+    [[nodiscard]] auto node_count() const -> std::size_t { return node_cpus_.size(); }
+
+    // Kernel id of a dense node index (as in /sys/devices/system/node/nodeN)
+    [[nodiscard]] auto node_id(std::size_t node) const -> unsigned { return node_ids_[node]; }
+
+    [[nodiscard]] auto cpus(std::size_t node) const -> const std::vector<unsigned>& {
+        return node_cpus_[node];
+    }
+
+    /**
+     * @brief Node of the CPU the calling thread is running on right now
+     */
+    [[nodiscard]] auto current_node() const -> std::size_t {
+#if defined(__linux__)
+        int cpu = sched_getcpu();
+        if (cpu >= 0 && static_cast<std::size_t>(cpu) < cpu_node_.size()) {
+            return cpu_node_[static_cast<std::size_t>(cpu)];
+        }
+#endif
+        return 0;
+    }
+
+    /**
+     * @brief Restrict the calling thread to the CPUs of `node`
+     */
+    auto pin_current_thread([[maybe_unused]] std::size_t node) const -> bool {
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (unsigned cpu : node_cpus_[node]) {
+            if (cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, &set);
+            }
+        }
+        return CPU_COUNT(&set) > 0 && sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+        return false;
+#endif
+    }
+
+  private:
+    NumaTopology() = default;
+
+    static auto detect() -> NumaTopology {
+        NumaTopology topology;
+        for (unsigned id : parse_list(read_line("/sys/devices/system/node/online"))) {
+            auto cpus = parse_list(
+                read_line("/sys/devices/system/node/node" + std::to_string(id) + "/cpulist"));
+            if (cpus.empty()) {
+                continue; // memory-only node: nothing runs there
+            }
+            for (unsigned cpu : cpus) {
+                if (cpu >= topology.cpu_node_.size()) {
+                    topology.cpu_node_.resize(cpu + 1, 0);
+                }
+                topology.cpu_node_[cpu] = topology.node_ids_.size();
+            }
+            topology.node_ids_.push_back(id);
+            topology.node_cpus_.push_back(std::move(cpus));
+        }
+
+        if (topology.node_ids_.empty()) {
+            topology.node_ids_.push_back(0);
+            topology.node_cpus_.emplace_back();
+            topology.cpu_node_.clear();
+        }
+        return topology;
+    }
+
+    static auto read_line(const std::string& path) -> std::string {
+        std::ifstream file(path);
+        std::string line;
+        std::getline(file, line);
+        return line;
+    }
+
+    // Kernel list format: "0-3,8,10-11"; malformed input yields an empty list
+    static auto parse_list(std::string_view text) -> std::vector<unsigned> {
+        std::vector<unsigned> values;
+        const char* pos = text.data();
+        const char* end = text.data() + text.size();
+        while (pos < end) {
+            unsigned first = 0;
+            auto [after_first, ec] = std::from_chars(pos, end, first);
+            if (ec != std::errc{}) {
+                return {};
+            }
+            unsigned last = first;
+            pos = after_first;
+            if (pos < end && *pos == '-') {
+                auto [after_last, ec_last] = std::from_chars(pos + 1, end, last);
+                if (ec_last != std::errc{} || last < first) {
+                    return {};
+                }
+                pos = after_last;
+            }
+            for (unsigned v = first; v <= last; ++v) {
+                values.push_back(v);
+            }
+            if (pos < end && *pos == ',') {
+                ++pos;
+            } else if (pos < end) {
+                return {};
+            }
+        }
+        return values;
+    }
+
+    std::vector<unsigned> node_ids_;
+    std::vector<std::vector<unsigned>> node_cpus_;
+    std::vector<std::size_t> cpu_node_;
+};
+
+} // namespace poolfactory
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+/**
+ * @brief Opt-in poisoning of idle pooled memory under ASan/MSan
+ *
+ * Define POOLFACTORY_POISON_IDLE=1 (CMake: -DPOOLFACTORY_POISON_IDLE=ON) and
+ * build with -fsanitize=address or -fsanitize=memory. Idle resources are then
+ * poisoned while they sit in a pool, so touching one through a pointer kept
+ * from before its release is reported like a use-after-free. Without a
+ * sanitizer, or with the macro unset, every hook below is an empty inline.
+ */
+#if !defined(POOLFACTORY_POISON_IDLE)
+#define POOLFACTORY_POISON_IDLE 0
+#endif
+
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define POOLFACTORY_HAS_ASAN 1
+#endif
+#if __has_feature(memory_sanitizer)
+#define POOLFACTORY_HAS_MSAN 1
+#endif
+#endif
+#if defined(__SANITIZE_ADDRESS__)
+#define POOLFACTORY_HAS_ASAN 1
+#endif
+
+#if POOLFACTORY_POISON_IDLE && defined(POOLFACTORY_HAS_ASAN)
+#include <sanitizer/asan_interface.h>
+#elif POOLFACTORY_POISON_IDLE && defined(POOLFACTORY_HAS_MSAN)
+#include <sanitizer/msan_interface.h>
+#endif
+
+namespace poolfactory {
+
+/**
+ * @brief A resource whose user-visible memory lives outside the object
+ *
+ * Pools always poison an idle object's own bytes where they store it. A type
+ * owning a heap buffer can also expose that buffer, so stale pointers into
+ * it are caught too:
+ *
+ *   auto poison_region() const -> std::span<const std::byte> {
+ *       return std::as_bytes(std::span{buffer_.get(), size_});
+ *   }
+ */
+template <typename T>
+concept PoisonableResource = requires(const T& t) {
+    { t.poison_region() } -> std::convertible_to<std::span<const std::byte>>;
+};
+
+namespace detail {
+
+inline void poison_memory([[maybe_unused]] const void* address,
+                          [[maybe_unused]] std::size_t size) noexcept {
+#if POOLFACTORY_POISON_IDLE && defined(POOLFACTORY_HAS_ASAN)
+    ASAN_POISON_MEMORY_REGION(address, size);
+#elif POOLFACTORY_POISON_IDLE && defined(POOLFACTORY_HAS_MSAN)
+    __msan_poison(address, size);
+#endif
+}
+
+inline void unpoison_memory([[maybe_unused]] const void* address,
+                            [[maybe_unused]] std::size_t size) noexcept {
+#if POOLFACTORY_POISON_IDLE && defined(POOLFACTORY_HAS_ASAN)
+    ASAN_UNPOISON_MEMORY_REGION(address, size);
+#elif POOLFACTORY_POISON_IDLE && defined(POOLFACTORY_HAS_MSAN)
+    // MSan tracks initialization: the idle bytes are still valid, mark them so
+    __msan_unpoison(address, size);
+#endif
+}
+
+/**
+ * @brief Poison an object that just became idle (its exposed region first)
+ */
+template <typename T> void poison_idle([[maybe_unused]] const T& object) noexcept {
+#if POOLFACTORY_POISON_IDLE
+    if constexpr (PoisonableResource<T>) {
+        std::span<const std::byte> region = object.poison_region();
+        poison_memory(region.data(), region.size());
+    }
+    poison_memory(&object, sizeof(T));
+#endif
+}
+
+/**
+ * @brief Unpoison an idle object before the pool touches it again
+ */
+template <typename T> void unpoison_idle([[maybe_unused]] const T& object) noexcept {
+#if POOLFACTORY_POISON_IDLE
+    unpoison_memory(&object, sizeof(T));
+    if constexpr (PoisonableResource<T>) {
+        std::span<const std::byte> region = object.poison_region();
+        unpoison_memory(region.data(), region.size());
+    }
+#endif
+}
+
+} // namespace detail
+
+} // namespace poolfactory
@@ -1,13 +1,26 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <concepts>
 #include <condition_variable>
-#include <deque>
+#include <cstdint>
 #include <functional>
 #include <mutex>
+#include <optional>
+#include <span>
+#include <tuple>
 
+#include "poolfactory/cache_line.hpp"
 #include "poolfactory/concepts.hpp"
+#include "poolfactory/event_fd.hpp"
 #include "poolfactory/pool_config.hpp"
+#include "poolfactory/pool_error.hpp"
+#include "poolfactory/pool_group.hpp"
 #include "poolfactory/pooled_resource.hpp"
+#include "poolfactory/release_buffer.hpp"
+#include "poolfactory/ring_buffer.hpp"
 #include "poolfactory/result.hpp"
 #include "poolfactory/unit.hpp"
 
@@ -24,54 +37,109 @@ struct PoolStats {
     std::size_t in_use;
     std::size_t total_created;
     std::size_t max_size;
+    std::size_t weight{0}; // summed weight of idle and in-use resources
+    std::size_t shed{0};   // acquires refused by load shedding (ThreadSafePool)
 
     constexpr auto operator==(const PoolStats&) const -> bool = default;
 };
 
+namespace detail {
+
 /**
- * @brief Single-threaded resource pool
+ * @brief Returns a borrowed resource to its pool on scope exit
  *
- * Not thread-safe. Use ThreadSafePool for concurrent access.
- * The effectful boundary - mutations happen here, wrapped in Result.
+ * Used by with_resource() so the release call is a direct (inlinable)
+ * call into the concrete pool instead of going through PooledResource's
+ * type-erased releaser. Extra arguments (BasicPool: the charged weight)
+ * are passed on to release_resource().
+ */
+template <typename PoolT, typename T, typename... Extra> class ReleaseOnExit {
+  public:
+    ReleaseOnExit(PoolT& pool, T& resource, Extra... extra)
+        : pool_(pool), resource_(resource), extra_(extra...) {}
+
+    ReleaseOnExit(const ReleaseOnExit&) = delete;
+    auto operator=(const ReleaseOnExit&) -> ReleaseOnExit& = delete;
+
+    ~ReleaseOnExit() {
+        std::apply(
+            [this](Extra... extra) { pool_.release_resource(std::move(resource_), extra...); },
+            extra_);
+    }
+
+  private:
+    PoolT& pool_;
+    T& resource_;
+    [[no_unique_address]] std::tuple<Extra...> extra_;
+};
+
+/**
+ * @brief A resource on its way back to a BasicPool, with its charged weight
+ */
+template <typename T> struct Returned {
+    T resource;
+    std::size_t charged;
+};
+
+} // namespace detail
+
+/**
+ * @brief Shared pool core (CRTP base)
+ *
+ * Holds the pool state and the unsynchronized acquire/release steps.
+ * Concrete pools (Pool, ThreadSafePool) are final classes that supply
+ * acquire_resource(), release_resource() and stats(); everything is
+ * resolved statically, so acquire/use/release inlines end to end.
+ *
+ * Resources move between the idle list and handles, so T must be movable
+ * and factories return it by value; emplacing factories (Emplacer<T>&) are
+ * only accepted by StaticPool, whose slots never move.
+ *
+ * Each live resource is charged its weight against max_weight. A handle
+ * carries the charge of its resource; on release the resource is weighed
+ * again (after the resetter), the budget is adjusted by the difference,
+ * and the resource is discarded if the pool is then over budget. Derived
+ * pools take that charge as release_resource(resource, charged).
  */
-template <Poolable T> class Pool {
+template <typename Derived, Poolable T> class BasicPool {
   public:
     using Factory = std::function<Result<T>()>;
     using Validator = std::function<bool(const T&)>;
     using Resetter = std::function<Result<Unit>(T&)>;
+    using Weigher = std::function<std::size_t(const T&)>;
 
-    Pool(const Pool&) = delete;
-    auto operator=(const Pool&) -> Pool& = delete;
-    Pool(Pool&&) = delete;
-    auto operator=(Pool&&) -> Pool& = delete;
-
-    virtual ~Pool() = default;
+    BasicPool(const BasicPool&) = delete;
+    auto operator=(const BasicPool&) -> BasicPool& = delete;
+    BasicPool(BasicPool&&) = delete;
+    auto operator=(BasicPool&&) -> BasicPool& = delete;
 
     /**
      * @brief Acquire a resource from the pool
      */
-    [[nodiscard]] virtual auto acquire() -> Result<PooledResource<T>> {
-        // Try to get from available pool
-        if (!available_.empty()) {
-            T resource = std::move(available_.front());
-            available_.pop_front();
-
-            // Validate if configured
-            if (config_.validate_on_acquire && validator_ && !validator_(resource)) {
-                // Resource invalid, try to create new one
-                return create_and_wrap();
-            }
-
-            ++in_use_;
-            return wrap_resource(std::move(resource));
+    [[nodiscard]] auto acquire() -> PoolResult<PooledResource<T>> {
+        auto acquired = self().acquire_resource();
+        if (acquired.is_err()) {
+            return PoolResult<PooledResource<T>>::err(std::move(acquired).error());
         }
+        return wrap_resource(std::move(acquired).value());
+    }
 
-        // Need to create new resource
-        if (in_use_ >= config_.max_size) {
-            return Result<PooledResource<T>>::err("Pool exhausted: max_size reached");
+    /**
+     * @brief Acquire an idle resource satisfying pred
+     *
+     * Scans the idle list (O(idle)) for a resource already in the wanted
+     * state, e.g. a connection on the right database. Without a match it
+     * creates a new resource while the pool has room, and otherwise hands
+     * out any idle one; the caller must check and adjust its state.
+     */
+    template <typename Pred>
+        requires std::predicate<Pred&, const T&>
+    [[nodiscard]] auto acquire_matching(Pred pred) -> PoolResult<PooledResource<T>> {
+        auto acquired = self().acquire_matching_resource(pred);
+        if (acquired.is_err()) {
+            return PoolResult<PooledResource<T>>::err(std::move(acquired).error());
         }
-
-        return create_and_wrap();
+        return wrap_resource(std::move(acquired).value());
     }
 
     /**
@@ -81,60 +149,193 @@ template <Poolable T> class Pool {
      */
     template <typename F>
     auto with_resource(F&& f)
-        -> Result<std::conditional_t<std::is_void_v<std::invoke_result_t<F, T&>>,
-                                     Unit,
-                                     std::invoke_result_t<F, T&>>> {
+        -> PoolResult<std::conditional_t<std::is_void_v<std::invoke_result_t<F, T&>>,
+                                         Unit,
+                                         std::invoke_result_t<F, T&>>> {
         using RawR = std::invoke_result_t<F, T&>;
         using R = std::conditional_t<std::is_void_v<RawR>, Unit, RawR>;
 
-        auto acquired = acquire();
+        auto acquired = self().acquire_resource();
         if (acquired.is_err()) {
-            return Result<R>::err(std::move(acquired).error());
+            return PoolResult<R>::err(std::move(acquired).error());
         }
 
-        auto resource = std::move(acquired).value();
+        T resource = std::move(acquired).value();
+        detail::ReleaseOnExit<Derived, T, std::size_t> guard(self(), resource, weigh(resource));
         if constexpr (std::is_void_v<RawR>) {
-            f(resource.get());
-            return Result<R>::ok(unit);
+            f(resource);
+            return PoolResult<R>::ok(unit);
         } else {
-            return Result<R>::ok(f(resource.get()));
+            return PoolResult<R>::ok(f(resource));
         }
     }
 
-    /**
-     * @brief Get pool statistics (pure read)
-     */
-    [[nodiscard]] virtual auto stats() const -> PoolStats {
-        return PoolStats{
-            .available = available_.size(),
-            .in_use = in_use_,
-            .total_created = total_created_,
-            .max_size = config_.max_size,
-        };
-    }
-
     /**
      * @brief Get current configuration (pure read)
      */
     [[nodiscard]] auto config() const -> const PoolConfig& { return config_; }
 
   protected:
-    friend class PoolFactory;
-
-    Pool(Factory factory, Validator validator, Resetter resetter, PoolConfig config)
+    BasicPool(Factory factory,
+              Validator validator,
+              Resetter resetter,
+              PoolConfig config,
+              Weigher weigher = {},
+              detail::GroupSeat seat = {})
         : factory_(std::move(factory)), validator_(std::move(validator)),
-          resetter_(std::move(resetter)), config_(config) {
-        // Pre-warm pool to min_size
+          resetter_(std::move(resetter)), weigher_(std::move(weigher)), config_(config),
+          seat_(std::move(seat)), available_(config.max_size) {
+        // Pre-warm pool to min_size, within the weight and group budgets
         for (std::size_t i = 0; i < config_.min_size; ++i) {
+            if (seat_ && !seat_.try_acquire()) {
+                break;
+            }
             auto result = factory_();
-            if (result.is_ok()) {
-                available_.push_back(std::move(result).value());
-                ++total_created_;
+            if (result.is_err()) {
+                release_permit();
+                continue;
+            }
+            auto weight = weigh(result.value());
+            if (!fits_weight(weight)) {
+                release_permit();
+                break;
             }
+            available_.push_back(std::move(result).value());
+            weight_ += weight;
+            ++total_created_;
         }
     }
 
-    virtual void do_release(T resource) {
+    ~BasicPool() = default;
+
+    /**
+     * @brief Take an idle resource or create one (caller synchronizes)
+     */
+    auto acquire_unlocked() -> PoolResult<T> {
+        // Try to get from available pool
+        if (!available_.empty()) {
+            T resource = available_.take_front();
+
+            // Validate if configured
+            if (config_.validate_on_acquire && validator_ && !validator_(resource)) {
+                // Resource invalid, try to create new one
+                discard_unlocked(weigh(resource));
+                return create_unlocked();
+            }
+
+            ++in_use_;
+            return PoolResult<T>::ok(std::move(resource));
+        }
+
+        // Need to create new resource
+        if (in_use_ >= config_.max_size) {
+            return PoolResult<T>::err(PoolErrc::exhausted);
+        }
+
+        return create_unlocked();
+    }
+
+    /**
+     * @brief Take an idle resource matching pred, else create-or-any
+     */
+    template <typename Pred> auto acquire_matching_unlocked(Pred& pred) -> PoolResult<T> {
+        while (auto match = available_.take_first_if(pred)) {
+            if (config_.validate_on_acquire && validator_ && !validator_(*match)) {
+                discard_unlocked(weigh(*match)); // invalid: keep looking
+                continue;
+            }
+            ++in_use_;
+            return PoolResult<T>::ok(std::move(*match));
+        }
+
+        // No match: a fresh resource while there is room, else (or if that
+        // fails for any reason) any idle one
+        if (in_use_ + available_.size() < config_.max_size) {
+            auto created = create_unlocked();
+            if (created.is_ok() || available_.empty()) {
+                return created;
+            }
+        }
+        return acquire_unlocked();
+    }
+
+    auto create_unlocked() -> PoolResult<T> {
+        // Describes this call only, so a weight refusal is not taken for a group one
+        group_blocked_ = false;
+        if (config_.max_weight != 0 && weight_ >= config_.max_weight) {
+            return PoolResult<T>::err(PoolErrc::weight_exhausted);
+        }
+
+        // One group permit per live resource
+        group_blocked_ = seat_ && !seat_.try_acquire();
+        if (group_blocked_) {
+            return PoolResult<T>::err(PoolErrc::group_exhausted);
+        }
+
+        auto result = factory_();
+        if (result.is_err()) {
+            release_permit();
+            return PoolResult<T>::err(
+                PoolError(PoolErrc::factory_failed, std::move(result).error()));
+        }
+
+        // A weight is only known once the resource exists: one that does not
+        // fit the remaining budget is destroyed right away
+        auto weight = weigh(result.value());
+        if (!fits_weight(weight)) {
+            release_permit();
+            if (weight > config_.max_weight) {
+                // Could never fit, not even into an empty pool
+                return PoolResult<T>::err(
+                    PoolError(PoolErrc::invalid_config, "resource weight exceeds max_weight"));
+            }
+            rejected_weight_ = weight;
+            return PoolResult<T>::err(PoolErrc::weight_exhausted);
+        }
+
+        rejected_weight_ = 0;
+        weight_ += weight;
+        ++total_created_;
+        ++in_use_;
+        return PoolResult<T>::ok(std::move(result).value());
+    }
+
+    // A create turned away by the weight or group budget: worth retrying
+    // once resources are released
+    [[nodiscard]] static auto budget_refused(const PoolError& error) -> bool {
+        return error == PoolErrc::weight_exhausted || error == PoolErrc::group_exhausted;
+    }
+
+    /**
+     * @brief Whether an acquire could proceed now without waiting
+     *
+     * After a resource was rejected for its weight, waits until that much
+     * weight is free, so waiters do not create and destroy in a loop.
+     */
+    [[nodiscard]] auto has_capacity_unlocked() const -> bool {
+        if (!available_.empty()) {
+            return true;
+        }
+        if (in_use_ >= config_.max_size) {
+            return false;
+        }
+        return config_.max_weight == 0 ||
+               weight_ + std::max<std::size_t>(rejected_weight_, 1) <= config_.max_weight;
+    }
+
+    // Drop a resource for good: its charged weight and group permit leave
+    // the budgets
+    void discard_unlocked(std::size_t charged) {
+        weight_ -= charged;
+        release_permit();
+    }
+
+    /**
+     * @brief Reset, validate, re-weigh and return a resource (caller synchronizes)
+     *
+     * `charged` is the weight the resource was charged when handed out.
+     */
+    void release_unlocked(T resource, std::size_t charged) {
         --in_use_;
 
         // Reset resource if resetter provided
@@ -142,6 +343,7 @@ template <Poolable T> class Pool {
             auto reset_result = resetter_(resource);
             if (reset_result.is_err()) {
                 // Resource cannot be reset, discard it
+                discard_unlocked(charged);
                 return;
             }
         }
@@ -149,128 +351,520 @@ template <Poolable T> class Pool {
         // Validate on release if configured
         if (config_.validate_on_release && validator_ && !validator_(resource)) {
             // Resource invalid, discard
+            discard_unlocked(charged);
             return;
         }
 
+        // It may have grown or shrunk in use: charge what it weighs now,
+        // and drop it if that leaves the pool over budget
+        if (weigher_) {
+            auto weight = weigher_(resource);
+            weight_ = weight_ - charged + weight;
+            if (!fits_weight(0)) {
+                discard_unlocked(weight);
+                return;
+            }
+        }
+
         // Return to pool
         available_.push_back(std::move(resource));
     }
 
-    auto wrap_resource(T resource) -> Result<PooledResource<T>> {
-        auto releaser = [this](T r) { this->do_release(std::move(r)); };
-        return Result<PooledResource<T>>::ok(
-            PooledResource<T>(std::move(resource), std::move(releaser)));
+    [[nodiscard]] auto stats_unlocked() const -> PoolStats {
+        return PoolStats{
+            .available = available_.size(),
+            .in_use = in_use_,
+            .total_created = total_created_,
+            .max_size = config_.max_size,
+            .weight = weight_,
+        };
     }
 
-    auto create_and_wrap() -> Result<PooledResource<T>> {
-        auto result = factory_();
-        if (result.is_err()) {
-            return Result<PooledResource<T>>::err(result.error());
-        }
-
-        ++total_created_;
-        ++in_use_;
-        return wrap_resource(std::move(result).value());
+    // Hand out a resource taken by the derived pool; it is released back here
+    auto wrap_resource(T resource) -> PoolResult<PooledResource<T>> {
+        auto releaser = [this, charged = weigh(resource)](T r) {
+            self().release_resource(std::move(r), charged);
+        };
+        return PoolResult<PooledResource<T>>::ok(
+            PooledResource<T>(std::move(resource), std::move(releaser)));
     }
 
+    // Read-mostly: written at construction, read by every acquire/release
+    // and by config(); never shares a cache line with the state below
     Factory factory_;
     Validator validator_;
     Resetter resetter_;
+    Weigher weigher_;
     PoolConfig config_;
+    detail::GroupSeat seat_; // empty unless the pool belongs to a PoolGroup
 
-    std::deque<T> available_;
+    // Write-hot: updated by every acquire/release, starts on its own line.
+    // Preallocated to max_size: idle + in-use never exceeds it. An idle
+    // resource is untouched, so weigh() returns exactly what it was charged
+    alignas(cache_line_size) RingBuffer<T> available_;
     std::size_t in_use_{0};
     std::size_t total_created_{0};
+    std::size_t weight_{0};
+    std::size_t rejected_weight_{0};
+    bool group_blocked_{false}; // last create was refused a group permit
+
+    // Without a weigher every resource weighs 1
+    [[nodiscard]] auto weigh(const T& resource) const -> std::size_t {
+        return weigher_ ? weigher_(resource) : 1;
+    }
+
+  private:
+    auto self() -> Derived& { return static_cast<Derived&>(*this); }
+
+    [[nodiscard]] auto fits_weight(std::size_t weight) const -> bool {
+        return config_.max_weight == 0 || weight_ + weight <= config_.max_weight;
+    }
+
+    void release_permit() {
+        if (seat_) {
+            seat_.release();
+        }
+    }
+};
+
+/**
+ * @brief Single-threaded resource pool
+ *
+ * Not thread-safe. Use ThreadSafePool for concurrent access.
+ * The effectful boundary - mutations happen here, wrapped in Result.
+ */
+template <Poolable T> class Pool final : public BasicPool<Pool<T>, T> {
+    using Base = BasicPool<Pool<T>, T>;
+
+  public:
+    using typename Base::Factory;
+    using typename Base::Validator;
+    using typename Base::Resetter;
+    using typename Base::Weigher;
+
+    /**
+     * @brief Get pool statistics (pure read)
+     */
+    [[nodiscard]] auto stats() const -> PoolStats { return this->stats_unlocked(); }
+
+  private:
+    friend class PoolFactory;
+    friend Base;
+    friend class detail::ReleaseOnExit<Pool<T>, T, std::size_t>;
+
+    Pool(Factory factory,
+         Validator validator,
+         Resetter resetter,
+         PoolConfig config,
+         Weigher weigher = {})
+        : Base(std::move(factory),
+               std::move(validator),
+               std::move(resetter),
+               config,
+               std::move(weigher)) {}
+
+    auto acquire_resource() -> PoolResult<T> { return this->acquire_unlocked(); }
+
+    template <typename Pred> auto acquire_matching_resource(Pred& pred) -> PoolResult<T> {
+        return this->acquire_matching_unlocked(pred);
+    }
+
+    void release_resource(T resource, std::size_t charged) {
+        this->release_unlocked(std::move(resource), charged);
+    }
 };
 
 /**
  * @brief Thread-safe resource pool
  *
- * Wraps Pool with mutex protection and condition variable for waiting.
+ * Guards the shared core with a mutex and condition variable for waiting.
+ *
+ * With release batching configured (PoolConfig::with_release_batching),
+ * each thread collects its releases in a small private buffer and returns
+ * them under one lock acquisition with one notify: when the buffer is full,
+ * when its oldest entry exceeds the delay bound, or as soon as anyone is
+ * waiting. A waiter drains every buffer before it blocks, and an acquire
+ * that finds no idle resource flushes expired buffers before creating one.
+ * Buffered resources still count as in use.
+ *
+ * In a PoolGroup (PoolFactory::create_thread_safe_in_group), a create that
+ * the group refuses first reclaims an idle resource from a member above its
+ * fair share, and otherwise waits (without the pool lock) until the group
+ * gets a permit back or this pool releases a resource.
+ *
+ * With load shedding (PoolConfig::with_load_shedding), an acquire that
+ * would have to wait fails at once with PoolErrc::overloaded when
+ * max_waiters threads already wait, or when the expected wait (waiters
+ * ahead times the recent gap between releases) runs past its deadline.
+ * The release gap is only measured while the pool is saturated (nothing
+ * idle, nothing left to create), whether or not anyone waits, and is
+ * dropped as soon as a release finds it unsaturated: an estimate never
+ * outlives the load that produced it.
+ *
+ * Event loops that must not block use try_acquire(). A pool created with
+ * PoolFactory::create_thread_safe_pollable also owns an eventfd: when
+ * try_acquire_or_register() finds nothing, it registers one async waiter
+ * under the same lock, and the next release signals readiness_fd() for
+ * it. The loop calls drain_readiness() when the fd is readable and retries;
+ * a resource taken by someone else in between just means registering again.
  */
-template <Poolable T> class ThreadSafePool : public Pool<T> {
+template <Poolable T> class ThreadSafePool final : public BasicPool<ThreadSafePool<T>, T> {
+    using Base = BasicPool<ThreadSafePool<T>, T>;
+
   public:
-    using typename Pool<T>::Factory;
-    using typename Pool<T>::Validator;
-    using typename Pool<T>::Resetter;
+    using typename Base::Factory;
+    using typename Base::Validator;
+    using typename Base::Resetter;
+    using typename Base::Weigher;
+
+    // Stop group reclaims before the lock they take goes away
+    ~ThreadSafePool() {
+        if (this->seat_) {
+            this->seat_.detach();
+        }
+    }
 
     /**
-     * @brief Acquire a resource, blocking until available or timeout
+     * @brief Get pool statistics (thread-safe)
      */
-    [[nodiscard]] auto acquire() -> Result<PooledResource<T>> override {
-        std::unique_lock lock(mutex_);
+    [[nodiscard]] auto stats() const -> PoolStats {
+        std::lock_guard lock(mutex_);
+        auto stats = this->stats_unlocked();
+        stats.shed = shed_;
+        return stats;
+    }
 
-        auto deadline = std::chrono::steady_clock::now() + this->config_.acquire_timeout;
+    /**
+     * @brief Take a resource only if one is available now (never blocks)
+     *
+     * Fails with exhausted instead of waiting.
+     */
+    [[nodiscard]] auto try_acquire() -> PoolResult<PooledResource<T>> {
+        auto acquired = try_take(false);
+        if (acquired.is_err()) {
+            return PoolResult<PooledResource<T>>::err(std::move(acquired).error());
+        }
+        return this->wrap_resource(std::move(acquired).value());
+    }
 
-        // Wait for available resource or room to create new one
-        while (this->available_.empty() && this->in_use_ >= this->config_.max_size) {
-            if (cv_.wait_until(lock, deadline) == std::cv_status::timeout) {
-                return Result<PooledResource<T>>::err("Pool acquire timeout");
-            }
+    /**
+     * @brief try_acquire(), registering an async waiter if it fails
+     *
+     * Each registration is consumed by one signal of readiness_fd(), sent by
+     * the next release. Without a readiness fd this is try_acquire().
+     */
+    [[nodiscard]] auto try_acquire_or_register() -> PoolResult<PooledResource<T>> {
+        auto acquired = try_take(true);
+        if (acquired.is_err()) {
+            return PoolResult<PooledResource<T>>::err(std::move(acquired).error());
         }
+        return this->wrap_resource(std::move(acquired).value());
+    }
 
-        // Try to get from available pool
-        if (!this->available_.empty()) {
-            T resource = std::move(this->available_.front());
-            this->available_.pop_front();
+    // Withdraw one registration that no longer needs a signal
+    void cancel_registration() {
+        std::lock_guard lock(mutex_);
+        if (async_waiters_.load(std::memory_order_relaxed) > 0) {
+            async_waiters_.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
 
-            // Validate if configured
-            if (this->config_.validate_on_acquire && this->validator_ &&
-                !this->validator_(resource)) {
-                // Resource invalid, try to create new one
-                return create_and_wrap_locked();
-            }
+    /**
+     * @brief eventfd to poll for readability, or -1 if the pool has none
+     */
+    [[nodiscard]] auto readiness_fd() const -> int { return ready_ ? ready_->fd() : -1; }
+
+    // Consume pending readiness signals; returns how many there were
+    auto drain_readiness() -> std::uint64_t { return ready_ ? ready_->drain() : 0; }
 
-            ++this->in_use_;
-            return wrap_resource_locked(std::move(resource));
+    /**
+     * @brief Return every buffered release to the pool now
+     *
+     * A no-op unless release batching is enabled.
+     */
+    void flush_releases() {
+        if (releases_.enabled()) {
+            releases_.drain_all(
+                [this](std::span<detail::Returned<T>> batch) { release_batch(batch); });
         }
+    }
 
-        // Create new resource
-        return create_and_wrap_locked();
+  private:
+    friend class PoolFactory;
+    friend Base;
+    friend class detail::ReleaseOnExit<ThreadSafePool<T>, T, std::size_t>;
+
+    ThreadSafePool(Factory factory,
+                   Validator validator,
+                   Resetter resetter,
+                   PoolConfig config,
+                   Weigher weigher = {},
+                   detail::GroupSeat seat = {})
+        : Base(std::move(factory),
+               std::move(validator),
+               std::move(resetter),
+               config,
+               std::move(weigher),
+               std::move(seat)),
+          releases_(config.release_batch, config.release_delay) {
+        if (this->seat_) {
+            this->seat_.attach([this] { return shed_idle(); });
+        }
     }
 
     /**
-     * @brief Get pool statistics (thread-safe)
+     * @brief Acquire a resource, blocking until available or timeout
      */
-    [[nodiscard]] auto stats() const -> PoolStats override {
+    auto acquire_resource() -> PoolResult<T> {
+        return acquire_waiting([this] { return this->acquire_unlocked(); });
+    }
+
+    template <typename Pred> auto acquire_matching_resource(Pred& pred) -> PoolResult<T> {
+        return acquire_waiting([this, &pred] { return this->acquire_matching_unlocked(pred); });
+    }
+
+    // Wait for available resource or room to create new one, then take it;
+    // waits again when a fresh resource was turned away by the weight or
+    // group budget
+    template <typename Take> auto acquire_waiting(Take take) -> PoolResult<T> {
+        std::unique_lock lock(mutex_);
+        std::optional<std::chrono::steady_clock::time_point> deadline; // set on first wait
+        while (true) {
+            if (releases_.enabled() && this->available_.empty()) {
+                // Reuse releases past their delay rather than create
+                lock.unlock();
+                releases_.drain_expired(
+                    [this](std::span<detail::Returned<T>> batch) { release_batch(batch); });
+                lock.lock();
+            }
+            if (!this->has_capacity_unlocked()) {
+                if (!deadline) {
+                    deadline = std::chrono::steady_clock::now() + this->config_.acquire_timeout;
+                }
+                if (should_shed_unlocked(*deadline)) {
+                    ++shed_;
+                    return PoolResult<T>::err(PoolErrc::overloaded);
+                }
+                if (!wait_until_ready(lock, *deadline)) {
+                    return PoolResult<T>::err(PoolErrc::timeout);
+                }
+            }
+            // With capacity ensured, a refusal can only come from a budget
+            auto acquired = take();
+            if (acquired.is_ok() || !this->budget_refused(acquired.error())) {
+                return acquired;
+            }
+            if (this->group_blocked_ && !wait_for_group(lock, deadline)) {
+                return PoolResult<T>::err(PoolErrc::timeout);
+            }
+        }
+    }
+
+    auto try_take(bool register_waiter) -> PoolResult<T> {
+        std::unique_lock lock(mutex_);
+        if (releases_.enabled() && this->available_.empty()) {
+            // A buffered release would be missed otherwise
+            lock.unlock();
+            flush_releases();
+            lock.lock();
+        }
+        if (this->has_capacity_unlocked()) {
+            auto acquired = this->acquire_unlocked();
+            if (acquired.is_ok() || !this->budget_refused(acquired.error())) {
+                return acquired;
+            }
+        }
+        if (register_waiter && ready_) {
+            async_waiters_.fetch_add(1, std::memory_order_relaxed);
+            if (releases_.enabled()) {
+                // Registered first: anything buffered since the drain above
+                // is flushed now and signals us
+                lock.unlock();
+                flush_releases();
+            }
+        }
+        return PoolResult<T>::err(PoolErrc::exhausted);
+    }
+
+    // Registered async waiters to signal for `released` resources
+    auto claim_signals_unlocked(std::size_t released) -> std::size_t {
+        auto registered = async_waiters_.load(std::memory_order_relaxed);
+        if (registered == 0) {
+            return 0; // common case: no read-modify-write on the release path
+        }
+        auto signals = std::min(registered, released);
+        async_waiters_.fetch_sub(signals, std::memory_order_relaxed);
+        return signals;
+    }
+
+    void signal_ready(std::size_t signals) {
+        if (signals > 0) {
+            ready_->signal(signals);
+        }
+    }
+
+    // Reclaim a permit from a member above its share, else wait for the
+    // group to get one back (or for a local release); false on timeout
+    auto wait_for_group(std::unique_lock<std::mutex>& lock,
+                        std::optional<std::chrono::steady_clock::time_point>& deadline) -> bool {
+        if (!deadline) {
+            deadline = std::chrono::steady_clock::now() + this->config_.acquire_timeout;
+        }
+        // Counted as a waiter so buffered releases flush straight through;
+        // one already buffered may be all we need
+        waiters_.fetch_add(1);
+        if (releases_.enabled()) {
+            lock.unlock();
+            flush_releases();
+            lock.lock();
+            if (!this->available_.empty()) {
+                waiters_.fetch_sub(1);
+                return true;
+            }
+        }
+        // Announced under our lock: a release after this point wakes us
+        auto seen = this->seat_.begin_wait();
+
+        // Never call into another pool, or block, while holding our own lock
+        lock.unlock();
+        bool ready = this->seat_.reclaim_or_wait(seen, *deadline);
+        lock.lock();
+        waiters_.fetch_sub(1);
+        return ready;
+    }
+
+    // Group reclaim: destroy the oldest idle resource, returning its permit
+    auto shed_idle() -> bool {
         std::lock_guard lock(mutex_);
-        return Pool<T>::stats();
+        if (this->available_.empty()) {
+            return false;
+        }
+        T resource = this->available_.take_front();
+        this->discard_unlocked(this->weigh(resource));
+        return true;
     }
 
-  protected:
-    friend class PoolFactory;
+    // Load shedding: refuse to queue behind max_waiters, or when the wait
+    // is expected to outlast the deadline
+    auto should_shed_unlocked(std::chrono::steady_clock::time_point deadline) const -> bool {
+        const auto& config = this->config_;
+        auto waiting = waiters_.load(std::memory_order_relaxed);
+        if (config.max_waiters != 0 && waiting >= config.max_waiters) {
+            return true;
+        }
+        if (!config.shed_late_waits || release_gap_ns_ == 0.0) {
+            return false;
+        }
+        // Every waiter ahead of us needs a release first
+        auto expected = std::chrono::nanoseconds(
+            static_cast<std::int64_t>(static_cast<double>(waiting + 1) * release_gap_ns_));
+        return std::chrono::steady_clock::now() + expected > deadline;
+    }
 
-    ThreadSafePool(Factory factory, Validator validator, Resetter resetter, PoolConfig config)
-        : Pool<T>(std::move(factory), std::move(validator), std::move(resetter), config) {}
+    // false on timeout
+    auto wait_until_ready(std::unique_lock<std::mutex>& lock,
+                          std::chrono::steady_clock::time_point deadline) -> bool {
+        auto ready = [this] { return this->has_capacity_unlocked(); };
+
+        // Announce the waiter first: releases buffered after the drain
+        // below see it and flush straight through
+        waiters_.fetch_add(1);
+        if (releases_.enabled()) {
+            lock.unlock();
+            flush_releases();
+            lock.lock();
+        }
+        bool woken = cv_.wait_until(lock, deadline, ready);
+        waiters_.fetch_sub(1);
+        return woken;
+    }
+
+    // Whether the next release should be sampled (call before releasing)
+    [[nodiscard]] auto saturated_unlocked() const -> bool {
+        return this->config_.shed_late_waits && !this->has_capacity_unlocked();
+    }
+
+    // Track the gap between releases of a saturated pool, the only state in
+    // which acquires queue; even shed acquires keep it up to date, so a
+    // slow estimate recovers once releases speed up. Any other release ends
+    // the episode and drops the estimate; those never read the clock
+    void note_releases_unlocked(std::size_t count, bool saturated) {
+        if (!saturated) {
+            release_gap_ns_ = 0.0;
+            last_release_ = {};
+            return;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (last_release_ != std::chrono::steady_clock::time_point{}) {
+            auto elapsed = std::chrono::duration<double, std::nano>(now - last_release_);
+            auto gap = elapsed.count() / static_cast<double>(count);
+            release_gap_ns_ =
+                release_gap_ns_ == 0.0
+                    ? gap
+                    : release_gap_alpha * gap + (1.0 - release_gap_alpha) * release_gap_ns_;
+        }
+        last_release_ = now;
+    }
 
-    void do_release(T resource) override {
+    void release_resource(T resource, std::size_t charged) {
+        if (releases_.enabled()) {
+            releases_.push(
+                detail::Returned<T>{std::move(resource), charged},
+                [this] { return waiters_.load() > 0 || async_waiters_.load() > 0; },
+                [this](std::span<detail::Returned<T>> batch) { release_batch(batch); });
+            return;
+        }
+        std::size_t signals = 0;
         {
             std::lock_guard lock(mutex_);
-            Pool<T>::do_release(std::move(resource));
+            bool saturated = saturated_unlocked();
+            this->release_unlocked(std::move(resource), charged);
+            note_releases_unlocked(1, saturated);
+            signals = claim_signals_unlocked(1);
         }
         cv_.notify_one();
+        signal_ready(signals);
+        this->seat_.wake_waiters();
     }
 
-  private:
-    auto wrap_resource_locked(T resource) -> Result<PooledResource<T>> {
-        auto releaser = [this](T r) { this->do_release(std::move(r)); };
-        return Result<PooledResource<T>>::ok(
-            PooledResource<T>(std::move(resource), std::move(releaser)));
-    }
-
-    auto create_and_wrap_locked() -> Result<PooledResource<T>> {
-        auto result = this->factory_();
-        if (result.is_err()) {
-            return Result<PooledResource<T>>::err(result.error());
+    // One lock and one notify for a whole batch of releases
+    void release_batch(std::span<detail::Returned<T>> batch) {
+        std::size_t signals = 0;
+        {
+            std::lock_guard lock(mutex_);
+            bool saturated = saturated_unlocked();
+            for (auto& returned : batch) {
+                this->release_unlocked(std::move(returned.resource), returned.charged);
+            }
+            note_releases_unlocked(batch.size(), saturated);
+            signals = claim_signals_unlocked(batch.size());
         }
-
-        ++this->total_created_;
-        ++this->in_use_;
-        return wrap_resource_locked(std::move(result).value());
+        if (batch.size() == 1) {
+            cv_.notify_one();
+        } else {
+            cv_.notify_all();
+        }
+        signal_ready(signals);
+        this->seat_.wake_waiters();
     }
 
-    mutable std::mutex mutex_;
+    // Lock and wait queue: contended by every caller; starts a fresh line
+    // after the base's hot state, away from the read-mostly config
+    alignas(cache_line_size) mutable std::mutex mutex_;
     std::condition_variable cv_;
+    std::atomic<std::size_t> waiters_{0};
+
+    // Load shedding, guarded by mutex_
+    static constexpr double release_gap_alpha = 0.2; // EWMA weight of the newest gap
+    std::size_t shed_{0};
+    double release_gap_ns_{0.0};
+    std::chrono::steady_clock::time_point last_release_{};
+
+    // Event-loop readiness: set by PoolFactory before the pool is shared
+    std::optional<detail::EventFd> ready_;
+    std::atomic<std::size_t> async_waiters_{0}; // written under mutex_
+
+    detail::ReleaseBuffers<detail::Returned<T>> releases_;
 };
 
 } // namespace poolfactory
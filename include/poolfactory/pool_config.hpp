@@ -14,10 +14,15 @@ namespace poolfactory {
 struct PoolConfig {
     std::size_t min_size{0};
     std::size_t max_size{10};
+    std::size_t max_weight{0}; // budget for the summed resource weights (0: none)
     std::chrono::milliseconds acquire_timeout{std::chrono::seconds{30}};
     std::chrono::milliseconds idle_timeout{std::chrono::minutes{5}};
     bool validate_on_acquire{true};
     bool validate_on_release{false};
+    std::size_t release_batch{0}; // ThreadSafePool: releases coalesced per thread (<= 1: off)
+    std::chrono::microseconds release_delay{100};
+    std::size_t max_waiters{0}; // ThreadSafePool: acquires blocked at once (0: no limit)
+    bool shed_late_waits{false}; // ThreadSafePool: refuse waits expected to time out
 
     // Builder methods - pure functions returning new config
     [[nodiscard]] constexpr auto with_min_size(std::size_t n) const -> PoolConfig {
@@ -32,6 +37,12 @@ struct PoolConfig {
         return copy;
     }
 
+    [[nodiscard]] constexpr auto with_max_weight(std::size_t w) const -> PoolConfig {
+        auto copy = *this;
+        copy.max_weight = w;
+        return copy;
+    }
+
     [[nodiscard]] constexpr auto with_acquire_timeout(std::chrono::milliseconds t) const
         -> PoolConfig {
         auto copy = *this;
@@ -54,6 +65,24 @@ struct PoolConfig {
         return copy;
     }
 
+    [[nodiscard]] constexpr auto with_release_batching(std::size_t batch,
+                                                       std::chrono::microseconds max_delay) const
+        -> PoolConfig {
+        auto copy = *this;
+        copy.release_batch = batch;
+        copy.release_delay = max_delay;
+        return copy;
+    }
+
+    [[nodiscard]] constexpr auto with_load_shedding(std::size_t max_waiters,
+                                                    bool shed_late_waits = true) const
+        -> PoolConfig {
+        auto copy = *this;
+        copy.max_waiters = max_waiters;
+        copy.shed_late_waits = shed_late_waits;
+        return copy;
+    }
+
     constexpr auto operator==(const PoolConfig&) const -> bool = default;
 };
 
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "poolfactory/result.hpp"
+
+namespace poolfactory {
+
+/**
+ * @brief What went wrong in a pool operation
+ */
+enum class PoolErrc : std::uint8_t {
+    exhausted,        // no idle resource and max_size reached
+    weight_exhausted, // a new resource would not fit max_weight
+    group_exhausted,  // the pool's PoolGroup has no permit to spare
+    timeout,          // acquire_timeout elapsed while waiting
+    overloaded,       // load shedding refused to wait (max_waiters, expected wait)
+    factory_failed,   // the resource factory returned an error
+    invalid_config,   // PoolFactory rejected the configuration
+};
+
+[[nodiscard]] constexpr auto to_string(PoolErrc code) -> std::string_view {
+    switch (code) {
+    case PoolErrc::exhausted:
+        return "Pool exhausted: max_size reached";
+    case PoolErrc::weight_exhausted:
+        return "Pool exhausted: max_weight reached";
+    case PoolErrc::group_exhausted:
+        return "Pool exhausted: group capacity reached";
+    case PoolErrc::timeout:
+        return "Pool acquire timeout";
+    case PoolErrc::overloaded:
+        return "Pool overloaded: acquire shed";
+    case PoolErrc::factory_failed:
+        return "Resource factory failed";
+    case PoolErrc::invalid_config:
+        return "Invalid pool config";
+    }
+    return "Unknown pool error";
+}
+
+/**
+ * @brief Default error type for pool operations
+ *
+ * A code plus an optional detail string, packed into one pointer-sized word.
+ * Rejections (exhausted, weight_exhausted, group_exhausted, timeout,
+ * overloaded) carry no detail: the code is stored inline, so building,
+ * copying and propagating them never allocates, and the human-readable
+ * text is only formatted when message() is called.
+ * Details (factory errors, config problems) live in a shared, refcounted
+ * block and are never copied.
+ */
+class PoolError {
+  public:
+    constexpr PoolError(PoolErrc code) noexcept : bits_(inline_bits(code)) {}
+
+    PoolError(PoolErrc code, std::string detail)
+        : bits_(reinterpret_cast<std::uintptr_t>(new Detail{{1}, code, std::move(detail)})) {}
+
+    PoolError(const PoolError& other) noexcept : bits_(other.bits_) { retain(); }
+
+    PoolError(PoolError&& other) noexcept : bits_(other.bits_) {
+        other.bits_ = inline_bits(code());
+    }
+
+    auto operator=(const PoolError& other) noexcept -> PoolError& {
+        if (this != &other) {
+            other.retain();
+            release();
+            bits_ = other.bits_;
+        }
+        return *this;
+    }
+
+    auto operator=(PoolError&& other) noexcept -> PoolError& {
+        if (this != &other) {
+            release();
+            bits_ = other.bits_;
+            other.bits_ = inline_bits(code());
+        }
+        return *this;
+    }
+
+    ~PoolError() { release(); }
+
+    [[nodiscard]] auto code() const noexcept -> PoolErrc {
+        return is_inline() ? static_cast<PoolErrc>(bits_ >> 1) : detail_block()->code;
+    }
+
+    [[nodiscard]] auto detail() const noexcept -> std::string_view {
+        return is_inline() ? std::string_view{} : std::string_view{detail_block()->text};
+    }
+
+    /**
+     * @brief Format "<description>[: <detail>]" (allocates; call off the hot path)
+     */
+    [[nodiscard]] auto message() const -> std::string {
+        std::string text{to_string(code())};
+        if (!is_inline()) {
+            text.append(": ").append(detail_block()->text);
+        }
+        return text;
+    }
+
+    friend auto operator==(const PoolError& e, PoolErrc code) noexcept -> bool {
+        return e.code() == code;
+    }
+
+    friend auto operator<<(std::ostream& os, const PoolError& e) -> std::ostream& {
+        os << to_string(e.code());
+        if (!e.is_inline()) {
+            os << ": " << e.detail_block()->text;
+        }
+        return os;
+    }
+
+  private:
+    struct Detail {
+        std::atomic<std::size_t> refs;
+        PoolErrc code;
+        std::string text;
+    };
+
+    // Low bit set: code stored inline in the upper bits; clear: Detail*
+    static_assert(alignof(Detail) > 1);
+
+    static constexpr auto inline_bits(PoolErrc code) noexcept -> std::uintptr_t {
+        return (static_cast<std::uintptr_t>(code) << 1) | 1U;
+    }
+
+    [[nodiscard]] auto is_inline() const noexcept -> bool { return (bits_ & 1U) != 0; }
+
+    [[nodiscard]] auto detail_block() const noexcept -> Detail* {
+        return reinterpret_cast<Detail*>(bits_);
+    }
+
+    void retain() const noexcept {
+        if (!is_inline()) {
+            detail_block()->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void release() noexcept {
+        if (!is_inline() && detail_block()->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete detail_block();
+        }
+    }
+
+    std::uintptr_t bits_;
+};
+
+static_assert(sizeof(PoolError) == sizeof(void*));
+
+/**
+ * @brief Result of a pool operation
+ */
+template <typename T> using PoolResult = Result<T, PoolError>;
+
+} // namespace poolfactory
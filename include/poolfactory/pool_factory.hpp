@@ -1,11 +1,19 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include "poolfactory/concepts.hpp"
+#include "poolfactory/latency_pool.hpp"
+#include "poolfactory/numa_pool.hpp"
 #include "poolfactory/pool.hpp"
 #include "poolfactory/pool_config.hpp"
+#include "poolfactory/pool_error.hpp"
+#include "poolfactory/registered_buffers.hpp"
 #include "poolfactory/result.hpp"
+#include "poolfactory/shared_lease_pool.hpp"
+#include "poolfactory/tagged_pool.hpp"
+#include "poolfactory/thread_local_pool.hpp"
 #include "poolfactory/unit.hpp"
 
 namespace poolfactory {
@@ -33,7 +41,7 @@ class PoolFactory {
     template <Poolable T, typename Factory>
         requires ResourceFactory<Factory, T>
     [[nodiscard]] static auto create(Factory factory, PoolConfig config = default_config)
-        -> Result<std::shared_ptr<Pool<T>>> {
+        -> PoolResult<std::shared_ptr<Pool<T>>> {
 
         return create_with_lifecycle<T>(
             std::move(factory),
@@ -49,7 +57,7 @@ class PoolFactory {
         requires ResourceFactory<Factory, T> && ResourceValidator<Validator, T>
     [[nodiscard]] static auto
     create_validated(Factory factory, Validator validator, PoolConfig config = default_config)
-        -> Result<std::shared_ptr<Pool<T>>> {
+        -> PoolResult<std::shared_ptr<Pool<T>>> {
 
         return create_with_lifecycle<T>(
             std::move(factory),
@@ -68,17 +76,17 @@ class PoolFactory {
                                                     Validator validator,
                                                     Resetter resetter,
                                                     PoolConfig config = default_config)
-        -> Result<std::shared_ptr<Pool<T>>> {
+        -> PoolResult<std::shared_ptr<Pool<T>>> {
 
-        auto validation = validate_config(config);
+        auto validation = validate_config<T>(config);
         if (validation.is_err()) {
-            return Result<std::shared_ptr<Pool<T>>>::err(validation.error());
+            return PoolResult<std::shared_ptr<Pool<T>>>::err(validation.error());
         }
 
         auto pool = std::shared_ptr<Pool<T>>(
             new Pool<T>(std::move(factory), std::move(validator), std::move(resetter), config));
 
-        return Result<std::shared_ptr<Pool<T>>>::ok(std::move(pool));
+        return PoolResult<std::shared_ptr<Pool<T>>>::ok(std::move(pool));
     }
 
     // =========================================================================
@@ -92,7 +100,7 @@ class PoolFactory {
         requires ResourceFactory<Factory, T>
     [[nodiscard]] static auto create_thread_safe(Factory factory,
                                                  PoolConfig config = default_config)
-        -> Result<std::shared_ptr<ThreadSafePool<T>>> {
+        -> PoolResult<std::shared_ptr<ThreadSafePool<T>>> {
 
         return create_thread_safe_with_lifecycle<T>(
             std::move(factory),
@@ -109,7 +117,7 @@ class PoolFactory {
     [[nodiscard]] static auto create_thread_safe_validated(Factory factory,
                                                            Validator validator,
                                                            PoolConfig config = default_config)
-        -> Result<std::shared_ptr<ThreadSafePool<T>>> {
+        -> PoolResult<std::shared_ptr<ThreadSafePool<T>>> {
 
         return create_thread_safe_with_lifecycle<T>(
             std::move(factory),
@@ -128,28 +136,587 @@ class PoolFactory {
                                                                 Validator validator,
                                                                 Resetter resetter,
                                                                 PoolConfig config = default_config)
-        -> Result<std::shared_ptr<ThreadSafePool<T>>> {
+        -> PoolResult<std::shared_ptr<ThreadSafePool<T>>> {
 
-        auto validation = validate_config(config);
+        auto validation = validate_config<T>(config);
         if (validation.is_err()) {
-            return Result<std::shared_ptr<ThreadSafePool<T>>>::err(validation.error());
+            return PoolResult<std::shared_ptr<ThreadSafePool<T>>>::err(validation.error());
         }
 
         auto pool = std::shared_ptr<ThreadSafePool<T>>(new ThreadSafePool<T>(
             std::move(factory), std::move(validator), std::move(resetter), config));
 
-        return Result<std::shared_ptr<ThreadSafePool<T>>>::ok(std::move(pool));
+        return PoolResult<std::shared_ptr<ThreadSafePool<T>>>::ok(std::move(pool));
+    }
+
+    // =========================================================================
+    // Pollable pool creation (event loops)
+    // =========================================================================
+
+    /**
+     * @brief Create a thread-safe pool with an eventfd for event loops
+     *
+     * See ThreadSafePool::try_acquire_or_register and readiness_fd.
+     * Fails with invalid_config where eventfd is unavailable.
+     */
+    template <Poolable T, typename Factory>
+        requires ResourceFactory<Factory, T>
+    [[nodiscard]] static auto create_thread_safe_pollable(Factory factory,
+                                                          PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<ThreadSafePool<T>>> {
+
+        return create_thread_safe_pollable_with_lifecycle<T>(
+            std::move(factory),
+            [](const T&) { return true; },
+            [](T&) { return Result<Unit>::ok(unit); },
+            config);
+    }
+
+    /**
+     * @brief Create a pollable thread-safe pool with validator and resetter
+     */
+    template <Poolable T, typename Factory, typename Validator, typename Resetter>
+        requires ResourceFactory<Factory, T> && ResourceValidator<Validator, T> &&
+                 ResourceResetter<Resetter, T>
+    [[nodiscard]] static auto
+    create_thread_safe_pollable_with_lifecycle(Factory factory,
+                                               Validator validator,
+                                               Resetter resetter,
+                                               PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<ThreadSafePool<T>>> {
+
+        auto validation = validate_config<T>(config);
+        if (validation.is_err()) {
+            return PoolResult<std::shared_ptr<ThreadSafePool<T>>>::err(validation.error());
+        }
+
+        auto ready = detail::EventFd::create();
+        if (ready.is_err()) {
+            return PoolResult<std::shared_ptr<ThreadSafePool<T>>>::err(ready.error());
+        }
+
+        auto pool = std::shared_ptr<ThreadSafePool<T>>(new ThreadSafePool<T>(
+            std::move(factory), std::move(validator), std::move(resetter), config));
+        pool->ready_.emplace(std::move(ready).value());
+
+        return PoolResult<std::shared_ptr<ThreadSafePool<T>>>::ok(std::move(pool));
+    }
+
+    // =========================================================================
+    // Weighted pool creation
+    // =========================================================================
+
+    /**
+     * @brief Create a single-threaded pool whose resources weigh weigher(resource)
+     *
+     * config.max_weight caps the summed weight of idle and in-use resources.
+     * max_size still caps the count and sizes the idle list allocated up
+     * front, so keep it to the most resources the pool may really hold.
+     */
+    template <Poolable T, typename Factory, typename Weigher>
+        requires ResourceFactory<Factory, T> && ResourceWeigher<Weigher, T>
+    [[nodiscard]] static auto
+    create_weighted(Factory factory, Weigher weigher, PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<Pool<T>>> {
+
+        return create_weighted_with_lifecycle<T>(
+            std::move(factory),
+            std::move(weigher),
+            [](const T&) { return true; },
+            [](T&) { return Result<Unit>::ok(unit); },
+            config);
+    }
+
+    /**
+     * @brief Create a weighted single-threaded pool with full lifecycle management
+     *
+     * Resources are weighed again after the resetter runs on release.
+     */
+    template <Poolable T,
+              typename Factory,
+              typename Weigher,
+              typename Validator,
+              typename Resetter>
+        requires ResourceFactory<Factory, T> && ResourceWeigher<Weigher, T> &&
+                 ResourceValidator<Validator, T> && ResourceResetter<Resetter, T>
+    [[nodiscard]] static auto create_weighted_with_lifecycle(Factory factory,
+                                                             Weigher weigher,
+                                                             Validator validator,
+                                                             Resetter resetter,
+                                                             PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<Pool<T>>> {
+
+        auto validation = validate_config<T>(config);
+        if (validation.is_err()) {
+            return PoolResult<std::shared_ptr<Pool<T>>>::err(validation.error());
+        }
+
+        auto pool = std::shared_ptr<Pool<T>>(new Pool<T>(std::move(factory),
+                                                         std::move(validator),
+                                                         std::move(resetter),
+                                                         config,
+                                                         std::move(weigher)));
+
+        return PoolResult<std::shared_ptr<Pool<T>>>::ok(std::move(pool));
+    }
+
+    /**
+     * @brief Create a thread-safe pool that waits on weight capacity
+     */
+    template <Poolable T, typename Factory, typename Weigher>
+        requires ResourceFactory<Factory, T> && ResourceWeigher<Weigher, T>
+    [[nodiscard]] static auto create_thread_safe_weighted(Factory factory,
+                                                          Weigher weigher,
+                                                          PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<ThreadSafePool<T>>> {
+
+        return create_thread_safe_weighted_with_lifecycle<T>(
+            std::move(factory),
+            std::move(weigher),
+            [](const T&) { return true; },
+            [](T&) { return Result<Unit>::ok(unit); },
+            config);
+    }
+
+    /**
+     * @brief Create a weighted thread-safe pool with full lifecycle management
+     */
+    template <Poolable T,
+              typename Factory,
+              typename Weigher,
+              typename Validator,
+              typename Resetter>
+        requires ResourceFactory<Factory, T> && ResourceWeigher<Weigher, T> &&
+                 ResourceValidator<Validator, T> && ResourceResetter<Resetter, T>
+    [[nodiscard]] static auto
+    create_thread_safe_weighted_with_lifecycle(Factory factory,
+                                               Weigher weigher,
+                                               Validator validator,
+                                               Resetter resetter,
+                                               PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<ThreadSafePool<T>>> {
+
+        auto validation = validate_config<T>(config);
+        if (validation.is_err()) {
+            return PoolResult<std::shared_ptr<ThreadSafePool<T>>>::err(validation.error());
+        }
+
+        auto pool = std::shared_ptr<ThreadSafePool<T>>(new ThreadSafePool<T>(std::move(factory),
+                                                                             std::move(validator),
+                                                                             std::move(resetter),
+                                                                             config,
+                                                                             std::move(weigher)));
+
+        return PoolResult<std::shared_ptr<ThreadSafePool<T>>>::ok(std::move(pool));
+    }
+
+    // =========================================================================
+    // Pool group creation
+    // =========================================================================
+
+    /**
+     * @brief Create a budget of `capacity` resources shared by member pools
+     */
+    [[nodiscard]] static auto create_group(std::size_t capacity)
+        -> PoolResult<std::shared_ptr<PoolGroup>> {
+        if (capacity == 0) {
+            return PoolResult<std::shared_ptr<PoolGroup>>::err(
+                {PoolErrc::invalid_config, "group capacity cannot be 0"});
+        }
+        return PoolResult<std::shared_ptr<PoolGroup>>::ok(
+            std::shared_ptr<PoolGroup>(new PoolGroup(capacity)));
+    }
+
+    /**
+     * @brief Create a thread-safe pool drawing its resources from a group
+     *
+     * The pool is guaranteed `guarantee` resources of the group's capacity
+     * and may borrow whatever is not reserved for other members.
+     */
+    template <Poolable T, typename Factory>
+        requires ResourceFactory<Factory, T>
+    [[nodiscard]] static auto create_thread_safe_in_group(std::shared_ptr<PoolGroup> group,
+                                                          Factory factory,
+                                                          std::size_t guarantee,
+                                                          PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<ThreadSafePool<T>>> {
+
+        return create_thread_safe_in_group_with_lifecycle<T>(
+            std::move(group),
+            std::move(factory),
+            guarantee,
+            [](const T&) { return true; },
+            [](T&) { return Result<Unit>::ok(unit); },
+            config);
+    }
+
+    /**
+     * @brief Create a group member pool with validator and resetter
+     */
+    template <Poolable T, typename Factory, typename Validator, typename Resetter>
+        requires ResourceFactory<Factory, T> && ResourceValidator<Validator, T> &&
+                 ResourceResetter<Resetter, T>
+    [[nodiscard]] static auto
+    create_thread_safe_in_group_with_lifecycle(std::shared_ptr<PoolGroup> group,
+                                               Factory factory,
+                                               std::size_t guarantee,
+                                               Validator validator,
+                                               Resetter resetter,
+                                               PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<ThreadSafePool<T>>> {
+
+        auto validation = validate_config<T>(config);
+        if (validation.is_err()) {
+            return PoolResult<std::shared_ptr<ThreadSafePool<T>>>::err(validation.error());
+        }
+        if (!group) {
+            return PoolResult<std::shared_ptr<ThreadSafePool<T>>>::err(
+                {PoolErrc::invalid_config, "group cannot be null"});
+        }
+        if (guarantee > config.max_size) {
+            return PoolResult<std::shared_ptr<ThreadSafePool<T>>>::err(
+                {PoolErrc::invalid_config, "guarantee cannot exceed max_size"});
+        }
+
+        auto [joined, id] = group->join(guarantee);
+        if (!joined) {
+            return PoolResult<std::shared_ptr<ThreadSafePool<T>>>::err(
+                {PoolErrc::invalid_config, "group guarantees exceed capacity"});
+        }
+
+        auto pool = std::shared_ptr<ThreadSafePool<T>>(
+            new ThreadSafePool<T>(std::move(factory),
+                                  std::move(validator),
+                                  std::move(resetter),
+                                  config,
+                                  {},
+                                  detail::GroupSeat(std::move(group), id)));
+
+        return PoolResult<std::shared_ptr<ThreadSafePool<T>>>::ok(std::move(pool));
+    }
+
+    // =========================================================================
+    // Thread-local pool creation
+    // =========================================================================
+
+    /**
+     * @brief Create a thread-affine pool (one shard per calling thread)
+     */
+    template <Poolable T, typename Factory>
+        requires ResourceFactory<Factory, T>
+    [[nodiscard]] static auto create_thread_local(Factory factory,
+                                                  PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<ThreadLocalPool<T>>> {
+
+        return create_thread_local_with_lifecycle<T>(
+            std::move(factory),
+            [](const T&) { return true; },
+            [](T&) { return Result<Unit>::ok(unit); },
+            config);
+    }
+
+    /**
+     * @brief Create a thread-affine pool with custom validation
+     */
+    template <Poolable T, typename Factory, typename Validator>
+        requires ResourceFactory<Factory, T> && ResourceValidator<Validator, T>
+    [[nodiscard]] static auto create_thread_local_validated(Factory factory,
+                                                            Validator validator,
+                                                            PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<ThreadLocalPool<T>>> {
+
+        return create_thread_local_with_lifecycle<T>(
+            std::move(factory),
+            std::move(validator),
+            [](T&) { return Result<Unit>::ok(unit); },
+            config);
+    }
+
+    /**
+     * @brief Create a thread-affine pool with full lifecycle management
+     *
+     * The hooks are shared by every thread's shard and must be thread-safe.
+     */
+    template <Poolable T, typename Factory, typename Validator, typename Resetter>
+        requires ResourceFactory<Factory, T> && ResourceValidator<Validator, T> &&
+                 ResourceResetter<Resetter, T>
+    [[nodiscard]] static auto create_thread_local_with_lifecycle(Factory factory,
+                                                                 Validator validator,
+                                                                 Resetter resetter,
+                                                                 PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<ThreadLocalPool<T>>> {
+
+        auto validation = validate_config<T>(config);
+        if (validation.is_err()) {
+            return PoolResult<std::shared_ptr<ThreadLocalPool<T>>>::err(validation.error());
+        }
+
+        auto pool = std::shared_ptr<ThreadLocalPool<T>>(new ThreadLocalPool<T>(
+            std::move(factory), std::move(validator), std::move(resetter), config));
+
+        return PoolResult<std::shared_ptr<ThreadLocalPool<T>>>::ok(std::move(pool));
+    }
+
+    // =========================================================================
+    // NUMA-aware pool creation
+    // =========================================================================
+
+    /**
+     * @brief Create a pool with one sub-pool per NUMA node
+     */
+    template <Poolable T, typename Factory>
+        requires ResourceFactory<Factory, T>
+    [[nodiscard]] static auto create_numa(Factory factory, PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<NumaPool<T>>> {
+
+        return create_numa_with_lifecycle<T>(
+            std::move(factory),
+            [](const T&) { return true; },
+            [](T&) { return Result<Unit>::ok(unit); },
+            config);
+    }
+
+    /**
+     * @brief Create a NUMA-aware pool with custom validation
+     */
+    template <Poolable T, typename Factory, typename Validator>
+        requires ResourceFactory<Factory, T> && ResourceValidator<Validator, T>
+    [[nodiscard]] static auto
+    create_numa_validated(Factory factory, Validator validator, PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<NumaPool<T>>> {
+
+        return create_numa_with_lifecycle<T>(
+            std::move(factory),
+            std::move(validator),
+            [](T&) { return Result<Unit>::ok(unit); },
+            config);
+    }
+
+    /**
+     * @brief Create a NUMA-aware pool with full lifecycle management
+     *
+     * The config applies to each node's sub-pool.
+     */
+    template <Poolable T, typename Factory, typename Validator, typename Resetter>
+        requires ResourceFactory<Factory, T> && ResourceValidator<Validator, T> &&
+                 ResourceResetter<Resetter, T>
+    [[nodiscard]] static auto create_numa_with_lifecycle(Factory factory,
+                                                         Validator validator,
+                                                         Resetter resetter,
+                                                         PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<NumaPool<T>>> {
+
+        auto validation = validate_config<T>(config);
+        if (validation.is_err()) {
+            return PoolResult<std::shared_ptr<NumaPool<T>>>::err(validation.error());
+        }
+
+        auto pool = std::shared_ptr<NumaPool<T>>(new NumaPool<T>(
+            std::move(factory), std::move(validator), std::move(resetter), config));
+
+        return PoolResult<std::shared_ptr<NumaPool<T>>>::ok(std::move(pool));
+    }
+
+    // =========================================================================
+    // Registered buffer pool creation (io_uring)
+    // =========================================================================
+
+    /**
+     * @brief Create a pool of max_size buffers registered with an io_uring
+     *
+     * Allocates one page-aligned slab of max_size * buffer_size bytes and
+     * registers it with ring_fd once (IORING_REGISTER_BUFFERS); each buffer's
+     * index() is its buf_index for READ_FIXED / WRITE_FIXED. Without io_uring
+     * (or with ring_fd -1) the buffers are plain memory with index -1.
+     * Destroy the pool before closing the ring.
+     */
+    [[nodiscard]] static auto create_registered_buffers(int ring_fd,
+                                                        std::size_t buffer_size,
+                                                        PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<ThreadSafePool<RegisteredBuffer>>> {
+        using PoolT = ThreadSafePool<RegisteredBuffer>;
+
+        auto validation = validate_config<RegisteredBuffer>(config);
+        if (validation.is_err()) {
+            return PoolResult<std::shared_ptr<PoolT>>::err(validation.error());
+        }
+        if (buffer_size == 0 || buffer_size > SIZE_MAX / config.max_size) {
+            return PoolResult<std::shared_ptr<PoolT>>::err(
+                {PoolErrc::invalid_config, "buffer_size must be non-zero and fit one slab"});
+        }
+
+        auto slab = std::make_shared<detail::BufferSlab>(ring_fd, buffer_size, config.max_size);
+        if (!slab->allocated()) {
+            return PoolResult<std::shared_ptr<PoolT>>::err(
+                {PoolErrc::factory_failed, "could not allocate the buffer slab"});
+        }
+        auto pool = std::shared_ptr<PoolT>(new PoolT(
+            [slab] { return slab->take(); },
+            [](const RegisteredBuffer&) { return true; },
+            [](RegisteredBuffer&) { return Result<Unit>::ok(unit); },
+            config));
+
+        return PoolResult<std::shared_ptr<PoolT>>::ok(std::move(pool));
+    }
+
+    // =========================================================================
+    // Shared-lease pool creation
+    // =========================================================================
+
+    /**
+     * @brief Create a pool whose resources serve up to max_leases borrowers
+     *
+     * max_size bounds the number of resources, not the number of leases.
+     */
+    template <Poolable T, typename Factory>
+        requires ResourceFactory<Factory, T>
+    [[nodiscard]] static auto create_shared_lease(Factory factory,
+                                                  std::size_t max_leases,
+                                                  PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<SharedLeasePool<T>>> {
+
+        auto validation = validate_config<T>(config);
+        if (validation.is_err()) {
+            return PoolResult<std::shared_ptr<SharedLeasePool<T>>>::err(validation.error());
+        }
+        if (max_leases == 0) {
+            return PoolResult<std::shared_ptr<SharedLeasePool<T>>>::err(
+                {PoolErrc::invalid_config, "max_leases cannot be 0"});
+        }
+
+        auto pool = std::shared_ptr<SharedLeasePool<T>>(
+            new SharedLeasePool<T>(std::move(factory), max_leases, config));
+
+        return PoolResult<std::shared_ptr<SharedLeasePool<T>>>::ok(std::move(pool));
+    }
+
+    // =========================================================================
+    // Latency-aware pool creation
+    // =========================================================================
+
+    /**
+     * @brief Create a thread-safe pool that lends its fastest resources first
+     */
+    template <Poolable T, typename Factory>
+        requires ResourceFactory<Factory, T>
+    [[nodiscard]] static auto create_latency_aware(Factory factory,
+                                                   PoolConfig config = default_config,
+                                                   LatencyScoring scoring = {})
+        -> PoolResult<std::shared_ptr<LatencyAwarePool<T>>> {
+
+        return create_latency_aware_with_lifecycle<T>(
+            std::move(factory),
+            [](const T&) { return true; },
+            [](T&) { return Result<Unit>::ok(unit); },
+            config,
+            scoring);
+    }
+
+    /**
+     * @brief Create a latency-aware pool with custom validation
+     */
+    template <Poolable T, typename Factory, typename Validator>
+        requires ResourceFactory<Factory, T> && ResourceValidator<Validator, T>
+    [[nodiscard]] static auto create_latency_aware_validated(Factory factory,
+                                                             Validator validator,
+                                                             PoolConfig config = default_config,
+                                                             LatencyScoring scoring = {})
+        -> PoolResult<std::shared_ptr<LatencyAwarePool<T>>> {
+
+        return create_latency_aware_with_lifecycle<T>(
+            std::move(factory),
+            std::move(validator),
+            [](T&) { return Result<Unit>::ok(unit); },
+            config,
+            scoring);
+    }
+
+    /**
+     * @brief Create a latency-aware pool with full lifecycle management
+     */
+    template <Poolable T, typename Factory, typename Validator, typename Resetter>
+        requires ResourceFactory<Factory, T> && ResourceValidator<Validator, T> &&
+                 ResourceResetter<Resetter, T>
+    [[nodiscard]] static auto
+    create_latency_aware_with_lifecycle(Factory factory,
+                                        Validator validator,
+                                        Resetter resetter,
+                                        PoolConfig config = default_config,
+                                        LatencyScoring scoring = {})
+        -> PoolResult<std::shared_ptr<LatencyAwarePool<T>>> {
+
+        auto validation = validate_config<T>(config);
+        if (validation.is_err()) {
+            return PoolResult<std::shared_ptr<LatencyAwarePool<T>>>::err(validation.error());
+        }
+        if (!(scoring.alpha > 0.0 && scoring.alpha <= 1.0)) {
+            return PoolResult<std::shared_ptr<LatencyAwarePool<T>>>::err(
+                {PoolErrc::invalid_config, "alpha must be in (0, 1]"});
+        }
+
+        auto pool = std::shared_ptr<LatencyAwarePool<T>>(new LatencyAwarePool<T>(
+            std::move(factory), std::move(validator), std::move(resetter), config, scoring));
+
+        return PoolResult<std::shared_ptr<LatencyAwarePool<T>>>::ok(std::move(pool));
+    }
+
+    // =========================================================================
+    // Tag-indexed pool creation
+    // =========================================================================
+
+    /**
+     * @brief Create a thread-safe pool whose idle resources are indexed by tagger(resource)
+     */
+    template <Poolable T, typename Factory, typename Tagger>
+        requires ResourceFactory<Factory, T> && ResourceTagger<Tagger, T>
+    [[nodiscard]] static auto
+    create_tagged(Factory factory, Tagger tagger, PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<TaggedPool<T, detail::TagOf<Tagger, T>>>> {
+
+        return create_tagged_validated<T>(
+            std::move(factory), std::move(tagger), [](const T&) { return true; }, config);
+    }
+
+    /**
+     * @brief Create a tag-indexed pool with custom validation
+     */
+    template <Poolable T, typename Factory, typename Tagger, typename Validator>
+        requires ResourceFactory<Factory, T> && ResourceTagger<Tagger, T> &&
+                 ResourceValidator<Validator, T>
+    [[nodiscard]] static auto create_tagged_validated(Factory factory,
+                                                      Tagger tagger,
+                                                      Validator validator,
+                                                      PoolConfig config = default_config)
+        -> PoolResult<std::shared_ptr<TaggedPool<T, detail::TagOf<Tagger, T>>>> {
+        using PoolT = TaggedPool<T, detail::TagOf<Tagger, T>>;
+
+        auto validation = validate_config<T>(config);
+        if (validation.is_err()) {
+            return PoolResult<std::shared_ptr<PoolT>>::err(validation.error());
+        }
+
+        auto pool = std::shared_ptr<PoolT>(
+            new PoolT(std::move(factory), std::move(tagger), std::move(validator), config));
+
+        return PoolResult<std::shared_ptr<PoolT>>::ok(std::move(pool));
     }
 
   private:
-    [[nodiscard]] static auto validate_config(const PoolConfig& config) -> Result<Unit> {
+    // Idle lists are allocated up front at max_size, so it must be allocatable
+    template <typename T>
+    [[nodiscard]] static auto validate_config(const PoolConfig& config) -> PoolResult<Unit> {
         if (config.max_size == 0) {
-            return Result<Unit>::err("max_size cannot be 0");
+            return PoolResult<Unit>::err({PoolErrc::invalid_config, "max_size cannot be 0"});
+        }
+        if (config.max_size > std::allocator_traits<std::allocator<T>>::max_size({})) {
+            return PoolResult<Unit>::err(
+                {PoolErrc::invalid_config, "max_size is too large to allocate"});
         }
         if (config.min_size > config.max_size) {
-            return Result<Unit>::err("min_size cannot exceed max_size");
+            return PoolResult<Unit>::err(
+                {PoolErrc::invalid_config, "min_size cannot exceed max_size"});
         }
-        return Result<Unit>::ok(unit);
+        return PoolResult<Unit>::ok(unit);
     }
 };
 
@@ -175,4 +742,44 @@ template <Poolable T, typename Factory>
     return PoolFactory::create_thread_safe<T>(std::move(factory), config);
 }
 
+/**
+ * @brief Create a thread-affine pool (convenience function)
+ */
+template <Poolable T, typename Factory>
+    requires ResourceFactory<Factory, T>
+[[nodiscard]] auto make_thread_local_pool(Factory factory, PoolConfig config = default_config) {
+    return PoolFactory::create_thread_local<T>(std::move(factory), config);
+}
+
+/**
+ * @brief Create a NUMA-aware pool (convenience function)
+ */
+template <Poolable T, typename Factory>
+    requires ResourceFactory<Factory, T>
+[[nodiscard]] auto make_numa_pool(Factory factory, PoolConfig config = default_config) {
+    return PoolFactory::create_numa<T>(std::move(factory), config);
+}
+
+/**
+ * @brief Create a latency-aware pool (convenience function)
+ */
+template <Poolable T, typename Factory>
+    requires ResourceFactory<Factory, T>
+[[nodiscard]] auto make_latency_aware_pool(Factory factory,
+                                           PoolConfig config = default_config,
+                                           LatencyScoring scoring = {}) {
+    return PoolFactory::create_latency_aware<T>(std::move(factory), config, scoring);
+}
+
+/**
+ * @brief Create a shared-lease pool (convenience function)
+ */
+template <Poolable T, typename Factory>
+    requires ResourceFactory<Factory, T>
+[[nodiscard]] auto make_shared_lease_pool(Factory factory,
+                                          std::size_t max_leases,
+                                          PoolConfig config = default_config) {
+    return PoolFactory::create_shared_lease<T>(std::move(factory), max_leases, config);
+}
+
 } // namespace poolfactory
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace poolfactory {
+
+// Forward declarations
+class PoolFactory;
+class PoolGroup;
+
+namespace detail {
+
+/**
+ * @brief Liveness of one group member, shared with the group
+ *
+ * A reclaim calls into the member's pool without holding the group lock;
+ * holding `mutex` pins the pool while it runs, and the pool clears `shed`
+ * under it before it is destroyed.
+ */
+struct GroupMemberState {
+    std::mutex mutex;
+    std::function<bool()> shed; // destroy one idle resource; false if none
+};
+
+/**
+ * @brief A pool's seat in a PoolGroup: one permit per live resource
+ *
+ * Lock order: member state -> pool -> group. The group never calls into a
+ * pool while holding its own lock.
+ */
+class GroupSeat {
+  public:
+    GroupSeat() = default;
+    GroupSeat(std::shared_ptr<PoolGroup> group, std::uint64_t id);
+
+    GroupSeat(const GroupSeat&) = delete;
+    auto operator=(const GroupSeat&) -> GroupSeat& = delete;
+    GroupSeat(GroupSeat&& other) noexcept
+        : group_(std::move(other.group_)), id_(other.id_), state_(std::move(other.state_)) {}
+    auto operator=(GroupSeat&&) -> GroupSeat& = delete;
+
+    ~GroupSeat();
+
+    explicit operator bool() const { return group_ != nullptr; }
+
+    // Install the pool's shed callback (after the pool is constructed)
+    void attach(std::function<bool()> shed);
+
+    // Stop reclaims into the pool; call before the pool's state is destroyed
+    void detach();
+
+    // On refusal, remembers the group's epoch for begin_wait()
+    [[nodiscard]] auto try_acquire() -> bool;
+    void release(std::size_t permits = 1);
+
+    /**
+     * @brief After a refusal: announce a waiter and return the refusal's epoch
+     *
+     * Call under the pool lock, so a release that follows it wakes the
+     * waiter; then call reclaim_or_wait() with the epoch.
+     */
+    [[nodiscard]] auto begin_wait() -> std::uint64_t;
+
+    /**
+     * @brief Reclaim from another member, else wait for the group to change
+     *
+     * Waits until permits come back or a member releases a resource (see
+     * wake_waiters) after epoch `seen`. False on timeout. Call without the
+     * pool lock; ends the wait announced by begin_wait().
+     */
+    auto reclaim_or_wait(std::uint64_t seen, std::chrono::steady_clock::time_point deadline)
+        -> bool;
+
+    // A member released a resource: waiters recheck (they may reclaim it)
+    void wake_waiters();
+
+  private:
+    // Make another member shed an idle resource
+    auto reclaim() -> bool;
+
+    std::shared_ptr<PoolGroup> group_;
+    std::uint64_t id_{0};
+    std::shared_ptr<GroupMemberState> state_;
+    std::uint64_t refused_at_{0};
+};
+
+} // namespace detail
+
+/**
+ * @brief One resource budget shared by several pools
+ *
+ * Every live resource (idle or in use) of a member pool holds one permit,
+ * and at most `capacity` permits exist. Each member is guaranteed
+ * `guarantee` permits; capacity not reserved for another member's
+ * guarantee may be borrowed by anyone. A member that cannot get a permit
+ * reclaims an idle resource from the member furthest above its guarantee
+ * (any member above its guarantee qualifies: idle permits serve no one).
+ * With nothing to reclaim it waits for
+ * permits to be returned: every return bumps the group's epoch and wakes
+ * the members blocked on it.
+ *
+ * Create with PoolFactory::create_group, then create member pools with
+ * PoolFactory::create_thread_safe_in_group.
+ */
+class PoolGroup {
+  public:
+    PoolGroup(const PoolGroup&) = delete;
+    auto operator=(const PoolGroup&) -> PoolGroup& = delete;
+    PoolGroup(PoolGroup&&) = delete;
+    auto operator=(PoolGroup&&) -> PoolGroup& = delete;
+
+    ~PoolGroup() = default;
+
+    [[nodiscard]] auto capacity() const -> std::size_t { return capacity_; }
+
+    // Permits held by all members (live resources)
+    [[nodiscard]] auto held() const -> std::size_t {
+        std::lock_guard lock(mutex_);
+        return held_;
+    }
+
+    [[nodiscard]] auto member_count() const -> std::size_t {
+        std::lock_guard lock(mutex_);
+        return members_.size();
+    }
+
+    // Sum of the members' guarantees
+    [[nodiscard]] auto reserved() const -> std::size_t {
+        std::lock_guard lock(mutex_);
+        return reserved_;
+    }
+
+  private:
+    friend class PoolFactory;
+    friend class detail::GroupSeat;
+
+    struct Member {
+        std::uint64_t id;
+        std::size_t guarantee;
+        std::size_t held;
+        std::shared_ptr<detail::GroupMemberState> state;
+    };
+
+    explicit PoolGroup(std::size_t capacity) : capacity_(capacity) {}
+
+    // False when the guarantee cannot be honoured next to the existing ones
+    auto join(std::size_t guarantee) -> std::pair<bool, std::uint64_t> {
+        std::lock_guard lock(mutex_);
+        if (reserved_ + guarantee > capacity_) {
+            return {false, 0};
+        }
+        reserved_ += guarantee;
+        auto id = next_id_++;
+        members_.push_back(Member{id, guarantee, 0, std::make_shared<detail::GroupMemberState>()});
+        return {true, id};
+    }
+
+    void leave(std::uint64_t id) {
+        std::lock_guard lock(mutex_);
+        auto it = find(id);
+        held_ -= it->held;
+        reserved_ -= it->guarantee;
+        members_.erase(it);
+        changed();
+    }
+
+    auto state_of(std::uint64_t id) -> std::shared_ptr<detail::GroupMemberState> {
+        std::lock_guard lock(mutex_);
+        return find(id)->state;
+    }
+
+    auto try_acquire(std::uint64_t id, std::uint64_t& refused_at) -> bool {
+        std::lock_guard lock(mutex_);
+        auto& self = *find(id);
+
+        // Capacity still owed to other members below their guarantee
+        std::size_t owed = 0;
+        for (const auto& m : members_) {
+            if (m.id != id && m.held < m.guarantee) {
+                owed += m.guarantee - m.held;
+            }
+        }
+        if (held_ + owed >= capacity_) {
+            refused_at = epoch_;
+            return false;
+        }
+        ++self.held;
+        ++held_;
+        return true;
+    }
+
+    void release(std::uint64_t id, std::size_t permits) {
+        std::lock_guard lock(mutex_);
+        find(id)->held -= permits;
+        held_ -= permits;
+        changed();
+    }
+
+    // Counted from the refusal on, so a release racing with the reclaim
+    // search or the pool unlock still wakes the waiter
+    void add_waiter() { waiting_.fetch_add(1, std::memory_order_seq_cst); }
+    void remove_waiter() { waiting_.fetch_sub(1, std::memory_order_relaxed); }
+
+    [[nodiscard]] auto has_waiters() const -> bool {
+        return waiting_.load(std::memory_order_seq_cst) > 0;
+    }
+
+    auto wait(std::uint64_t seen, std::chrono::steady_clock::time_point deadline) -> bool {
+        std::unique_lock lock(mutex_);
+        return cv_.wait_until(lock, deadline, [&] { return epoch_ != seen; });
+    }
+
+    void wake() {
+        std::lock_guard lock(mutex_);
+        changed();
+    }
+
+    // Permits or idle resources may be available: waiters recheck
+    void changed() {
+        ++epoch_;
+        if (has_waiters()) {
+            cv_.notify_all();
+        }
+    }
+
+    // Members that may be asked to shed for `id`, most excess first
+    auto victims_for(std::uint64_t id) -> std::vector<std::shared_ptr<detail::GroupMemberState>> {
+        std::lock_guard lock(mutex_);
+        auto excess = [](const Member& m) {
+            return static_cast<std::ptrdiff_t>(m.held) - static_cast<std::ptrdiff_t>(m.guarantee);
+        };
+        // Only idle resources are shed, and a member with idle resources of
+        // its own serves its waiters from them, so taking from anyone above
+        // their guarantee cannot ping-pong
+        std::vector<const Member*> candidates;
+        for (const auto& m : members_) {
+            if (m.id != id && excess(m) > 0) {
+                candidates.push_back(&m);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), [&](const Member* a, const Member* b) {
+            return excess(*a) > excess(*b);
+        });
+
+        std::vector<std::shared_ptr<detail::GroupMemberState>> victims;
+        victims.reserve(candidates.size());
+        for (const auto* m : candidates) {
+            victims.push_back(m->state);
+        }
+        return victims;
+    }
+
+    auto find(std::uint64_t id) -> std::vector<Member>::iterator {
+        return std::find_if(
+            members_.begin(), members_.end(), [id](const Member& m) { return m.id == id; });
+    }
+
+    std::size_t capacity_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<Member> members_;
+    std::size_t held_{0};
+    std::size_t reserved_{0};
+    std::uint64_t next_id_{1};
+    std::uint64_t epoch_{0}; // bumped whenever a waiter should recheck
+    std::atomic<std::size_t> waiting_{0};
+};
+
+namespace detail {
+
+inline GroupSeat::GroupSeat(std::shared_ptr<PoolGroup> group, std::uint64_t id)
+    : group_(std::move(group)), id_(id), state_(group_->state_of(id)) {}
+
+inline GroupSeat::~GroupSeat() {
+    if (group_) {
+        detach();
+        group_->leave(id_);
+    }
+}
+
+inline void GroupSeat::attach(std::function<bool()> shed) {
+    std::lock_guard lock(state_->mutex);
+    state_->shed = std::move(shed);
+}
+
+inline void GroupSeat::detach() {
+    std::lock_guard lock(state_->mutex);
+    state_->shed = nullptr;
+}
+
+inline auto GroupSeat::try_acquire() -> bool { return group_->try_acquire(id_, refused_at_); }
+
+inline void GroupSeat::release(std::size_t permits) { group_->release(id_, permits); }
+
+inline auto GroupSeat::reclaim() -> bool {
+    for (const auto& victim : group_->victims_for(id_)) {
+        std::lock_guard lock(victim->mutex);
+        if (victim->shed && victim->shed()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline auto GroupSeat::begin_wait() -> std::uint64_t {
+    group_->add_waiter();
+    return refused_at_;
+}
+
+inline auto GroupSeat::reclaim_or_wait(std::uint64_t seen,
+                                       std::chrono::steady_clock::time_point deadline) -> bool {
+    bool ready = reclaim() || group_->wait(seen, deadline);
+    group_->remove_waiter();
+    return ready;
+}
+
+inline void GroupSeat::wake_waiters() {
+    if (group_ && group_->has_waiters()) {
+        group_->wake();
+    }
+}
+
+} // namespace detail
+
+} // namespace poolfactory
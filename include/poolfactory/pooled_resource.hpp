@@ -8,10 +8,9 @@
 
 namespace poolfactory {
 
-// Forward declaration
-template <Poolable T> class Pool;
-
-template <Poolable T> class ThreadSafePool;
+// Forward declarations
+template <typename Derived, Poolable T> class BasicPool;
+template <Poolable T, typename Tag> class TaggedPool;
 
 /**
  * @brief RAII wrapper for a pooled resource
@@ -67,9 +66,8 @@ template <Poolable T> class PooledResource {
     }
 
   private:
-    template <Poolable U> friend class Pool;
-
-    template <Poolable U> friend class ThreadSafePool;
+    template <typename Derived, Poolable U> friend class BasicPool;
+    template <Poolable U, typename Tag> friend class TaggedPool;
 
     PooledResource(T resource, Releaser releaser)
         : resource_(std::move(resource)), releaser_(std::move(releaser)) {}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <span>
+#include <vector>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#define POOLFACTORY_HAS_IO_URING 1
+#endif
+
+#include "poolfactory/result.hpp"
+
+namespace poolfactory {
+
+namespace detail {
+class BufferSlab;
+}
+
+/**
+ * @brief One fixed-size slice of a registered buffer slab
+ *
+ * index() is the buf_index for IORING_OP_READ_FIXED / WRITE_FIXED, or -1
+ * when the slab could not be registered (use plain READ / WRITE then).
+ */
+class RegisteredBuffer {
+  public:
+    [[nodiscard]] auto data() const -> std::byte* { return data_; }
+    [[nodiscard]] auto size() const -> std::size_t { return size_; }
+    [[nodiscard]] auto span() const -> std::span<std::byte> { return {data_, size_}; }
+
+    [[nodiscard]] auto index() const -> int { return index_; }
+    [[nodiscard]] auto registered() const -> bool { return index_ >= 0; }
+
+  private:
+    friend class detail::BufferSlab;
+
+    RegisteredBuffer(std::byte* data, std::size_t size, int index)
+        : data_(data), size_(size), index_(index) {}
+
+    std::byte* data_;
+    std::size_t size_;
+    int index_;
+};
+
+namespace detail {
+
+/**
+ * @brief One allocation carved into equal buffers, registered once with a ring
+ *
+ * Registration pins the pages up front, so fixed reads and writes skip the
+ * per-operation pinning. If it fails (no io_uring, seccomp, RLIMIT_MEMLOCK,
+ * more than 16384 buffers) the slab still works as plain memory and every
+ * buffer reports index -1. The buffers are unregistered on destruction, so
+ * the slab must go before the ring is closed.
+ */
+class BufferSlab {
+  public:
+    static constexpr std::size_t alignment = 4096; // page: fit for O_DIRECT too
+
+    BufferSlab(int ring_fd, std::size_t buffer_size, std::size_t count)
+        : ring_fd_(ring_fd), buffer_size_(buffer_size), count_(count),
+          data_(static_cast<std::byte*>(
+              ::operator new(buffer_size * count, std::align_val_t{alignment}, std::nothrow))) {
+        registered_ = data_ != nullptr && register_buffers();
+    }
+
+    BufferSlab(const BufferSlab&) = delete;
+    auto operator=(const BufferSlab&) -> BufferSlab& = delete;
+    BufferSlab(BufferSlab&&) = delete;
+    auto operator=(BufferSlab&&) -> BufferSlab& = delete;
+
+    ~BufferSlab() {
+#if defined(POOLFACTORY_HAS_IO_URING)
+        if (registered_) {
+            ::syscall(__NR_io_uring_register, ring_fd_, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+        }
+#endif
+        ::operator delete(data_, std::align_val_t{alignment});
+    }
+
+    // false if the slab could not be allocated; check before use
+    [[nodiscard]] auto allocated() const -> bool { return data_ != nullptr; }
+    [[nodiscard]] auto registered() const -> bool { return registered_; }
+
+    // Pool factory: hands out each slice once (the pool never holds more)
+    auto take() -> Result<RegisteredBuffer> {
+        if (next_ == count_) {
+            return Result<RegisteredBuffer>::err("buffer slab exhausted");
+        }
+        auto index = next_++;
+        return Result<RegisteredBuffer>::ok(
+            RegisteredBuffer(data_ + index * buffer_size_,
+                             buffer_size_,
+                             registered_ ? static_cast<int>(index) : -1));
+    }
+
+  private:
+    auto register_buffers() -> bool {
+#if defined(POOLFACTORY_HAS_IO_URING)
+        if (ring_fd_ < 0) {
+            return false;
+        }
+        std::vector<iovec> iovecs(count_);
+        for (std::size_t i = 0; i < count_; ++i) {
+            iovecs[i] = iovec{data_ + i * buffer_size_, buffer_size_};
+        }
+        return ::syscall(__NR_io_uring_register,
+                         ring_fd_,
+                         IORING_REGISTER_BUFFERS,
+                         iovecs.data(),
+                         static_cast<unsigned>(count_)) == 0;
+#else
+        return false;
+#endif
+    }
+
+    int ring_fd_;
+    std::size_t buffer_size_;
+    std::size_t count_;
+    std::byte* data_;
+    bool registered_{false};
+    std::size_t next_{0}; // called under the pool's lock
+};
+
+} // namespace detail
+
+} // namespace poolfactory
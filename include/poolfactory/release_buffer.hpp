@@ -0,0 +1,171 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "poolfactory/thread_cache.hpp"
+
+namespace poolfactory::detail {
+
+/**
+ * @brief Per-thread buffers that coalesce releases into one pool
+ *
+ * Each releasing thread gets its own buffer (found through a thread-local
+ * cache), guarded by a mutex that only that thread and the occasional
+ * drain ever take, so it is uncontended. A buffer is handed to `flush` as
+ * one batch when it reaches `batch` resources, when the caller reports
+ * waiters, or when its oldest resource has waited `max_delay` (checked on
+ * later releases from the same thread, and by drain_expired() for threads
+ * that stopped releasing). Lock order is registry -> buffer -> pool.
+ */
+template <typename T> class ReleaseBuffers {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    ReleaseBuffers(std::size_t batch, std::chrono::microseconds max_delay)
+        : batch_(batch), max_delay_(max_delay),
+          stride_(std::clamp<std::size_t>(batch, 2, clock_stride + 1) - 1),
+          id_(batch > 1 ? ThreadLocalRegistry::register_pool() : 0) {}
+
+    ReleaseBuffers(const ReleaseBuffers&) = delete;
+    auto operator=(const ReleaseBuffers&) -> ReleaseBuffers& = delete;
+
+    // Buffered resources die with the pool, not with the last thread cache
+    ~ReleaseBuffers() {
+        if (!enabled()) {
+            return;
+        }
+        ThreadLocalRegistry::unregister_pool(id_);
+        std::lock_guard lock(mutex_);
+        for (auto& buffer : buffers_) {
+            std::lock_guard buffer_lock(buffer->mutex);
+            buffer->items.clear();
+        }
+    }
+
+    [[nodiscard]] auto enabled() const -> bool { return batch_ > 1; }
+
+    /**
+     * @brief Buffer one release; flush the calling thread's batch if due
+     *
+     * `urgent` is evaluated after the resource is buffered, under the buffer
+     * lock, so a waiter that drains before waiting cannot miss it.
+     */
+    template <typename Urgent, typename Flush>
+    void push(T resource, Urgent&& urgent, Flush&& flush) {
+        Buffer& buffer = local_buffer();
+        std::lock_guard lock(buffer.mutex);
+
+        if (buffer.items.empty()) {
+            buffer.oldest = Clock::now();
+        }
+        buffer.items.push_back(std::move(resource));
+
+        if (buffer.items.size() >= batch_ || urgent() || expired(buffer)) {
+            flush(std::span<T>(buffer.items));
+            buffer.items.clear();
+        }
+    }
+
+    /**
+     * @brief Flush every thread's buffer (called by waiters and flush_releases)
+     */
+    template <typename Flush> void drain_all(Flush&& flush) {
+        drain_if([](const Buffer&) { return true; }, flush);
+    }
+
+    /**
+     * @brief Flush the buffers whose oldest resource is past max_delay
+     *
+     * Called by acquires that find no idle resource, so a release parked by
+     * a thread that never releases again is not stranded.
+     */
+    template <typename Flush> void drain_expired(Flush&& flush) {
+        auto now = Clock::now();
+        drain_if([&](const Buffer& buffer) { return now - buffer.oldest >= max_delay_; }, flush);
+    }
+
+  private:
+    struct Buffer {
+        std::mutex mutex;
+        std::vector<T> items;
+        Clock::time_point oldest;
+    };
+
+    struct CacheEntry {
+        std::uint64_t pool_id;
+        std::shared_ptr<Buffer> buffer;
+    };
+
+    // Reading the clock costs about as much as the lock being saved, so
+    // the delay bound is only checked on every stride_-th release (at most
+    // clock_stride, fewer for small batches so one check still happens)
+    static constexpr std::size_t clock_stride = 4;
+
+    auto expired(const Buffer& buffer) const -> bool {
+        auto size = buffer.items.size();
+        return size > 1 && size % stride_ == 0 && Clock::now() - buffer.oldest >= max_delay_;
+    }
+
+    template <typename Pred, typename Flush> void drain_if(Pred&& due, Flush& flush) {
+        std::lock_guard lock(mutex_);
+        for (auto& buffer : buffers_) {
+            std::lock_guard buffer_lock(buffer->mutex);
+            if (!buffer->items.empty() && due(*buffer)) {
+                flush(std::span<T>(buffer->items));
+                buffer->items.clear();
+            }
+        }
+    }
+
+    auto local_buffer() -> Buffer& {
+        for (const auto& entry : cache()) {
+            if (entry.pool_id == id_) {
+                return *entry.buffer;
+            }
+        }
+        return register_thread();
+    }
+
+    // First release from this thread: create its buffer
+    auto register_thread() -> Buffer& {
+        auto& entries = cache();
+        ThreadLocalRegistry::prune(entries);
+
+        auto buffer = std::make_shared<Buffer>();
+        buffer->items.reserve(batch_);
+        {
+            std::lock_guard lock(mutex_);
+            // Drop empty buffers of threads that have exited
+            std::erase_if(buffers_, [](const std::shared_ptr<Buffer>& b) {
+                std::lock_guard buffer_lock(b->mutex);
+                return b.use_count() == 1 && b->items.empty();
+            });
+            buffers_.push_back(buffer);
+        }
+        entries.push_back(CacheEntry{id_, buffer});
+        return *buffer;
+    }
+
+    static auto cache() -> std::vector<CacheEntry>& {
+        thread_local std::vector<CacheEntry> entries;
+        return entries;
+    }
+
+    std::size_t batch_;
+    std::chrono::microseconds max_delay_;
+    std::size_t stride_;
+    std::uint64_t id_;
+
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<Buffer>> buffers_;
+};
+
+} // namespace poolfactory::detail
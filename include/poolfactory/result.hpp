@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cassert>
+#include <memory>
 #include <string>
-#include <variant>
+#include <type_traits>
+#include <utility>
 
 namespace poolfactory {
 
@@ -34,6 +37,13 @@ template <typename E> Err(E) -> Err<E>;
  * Uses tagged union (Ok<T>/Err<E>) to disambiguate success from failure,
  * even when T and E are the same type.
  *
+ * Storage is a plain union plus a one-byte tag: no variant bookkeeping, no
+ * valueless state, and copy/move/destruction are trivial whenever they are
+ * trivial for both T and E (Result<int, PoolErrc> is trivially copyable).
+ * Every combinator has an rvalue overload that moves instead of copying.
+ * value() on an Err and error() on an Ok are precondition violations,
+ * checked by assert.
+ *
  * Usage:
  *   auto result = parse_int("42");
  *   result.match(
@@ -41,23 +51,101 @@ template <typename E> Err(E) -> Err<E>;
  *       [](const std::string& e) { handle_error(e); }
  *   );
  */
-template <typename T, typename E = std::string> class Result {
+template <typename T, typename E = std::string> class [[nodiscard]] Result {
+    static constexpr bool copyable = std::is_copy_constructible_v<T> &&
+                                     std::is_copy_constructible_v<E>;
+    static constexpr bool trivially_copyable = std::is_trivially_copy_constructible_v<T> &&
+                                               std::is_trivially_copy_constructible_v<E>;
+    static constexpr bool trivially_movable = std::is_trivially_move_constructible_v<T> &&
+                                              std::is_trivially_move_constructible_v<E>;
+    static constexpr bool trivially_destructible = std::is_trivially_destructible_v<T> &&
+                                                   std::is_trivially_destructible_v<E>;
+
   public:
     static auto ok(T value) -> Result { return Result{Ok<T>{std::move(value)}}; }
     static auto err(E error) -> Result { return Result{Err<E>{std::move(error)}}; }
 
     // Construct from tagged values
-    Result(Ok<T> ok) : data_(std::move(ok)) {}
-    Result(Err<E> err) : data_(std::move(err)) {}
+    Result(Ok<T> ok) : value_(std::move(ok.value)), is_ok_(true) {}
+    Result(Err<E> err) : error_(std::move(err.value)), is_ok_(false) {}
+
+    Result(const Result&)
+        requires trivially_copyable
+    = default;
+    Result(const Result& other)
+        requires(copyable && !trivially_copyable)
+        : is_ok_(other.is_ok_) {
+        construct_from(other);
+    }
+
+    Result(Result&&)
+        requires trivially_movable
+    = default;
+    Result(Result&& other) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                    std::is_nothrow_move_constructible_v<E>)
+        requires(!trivially_movable)
+        : is_ok_(other.is_ok_) {
+        construct_from(std::move(other));
+    }
 
-    [[nodiscard]] auto is_ok() const -> bool { return std::holds_alternative<Ok<T>>(data_); }
-    [[nodiscard]] auto is_err() const -> bool { return !is_ok(); }
+    auto operator=(const Result&) -> Result&
+        requires(trivially_copyable && trivially_destructible)
+    = default;
+    auto operator=(const Result& other) -> Result&
+        requires(copyable && !(trivially_copyable && trivially_destructible))
+    {
+        if (this != &other) {
+            assign_from(other);
+        }
+        return *this;
+    }
 
-    [[nodiscard]] auto value() const& -> const T& { return std::get<Ok<T>>(data_).value; }
-    [[nodiscard]] auto value() && -> T { return std::move(std::get<Ok<T>>(data_).value); }
+    auto operator=(Result&&) -> Result&
+        requires(trivially_movable && trivially_destructible)
+    = default;
+    auto operator=(Result&& other) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                            std::is_nothrow_move_constructible_v<E>) -> Result&
+        requires(!(trivially_movable && trivially_destructible))
+    {
+        if (this != &other) {
+            assign_from(std::move(other));
+        }
+        return *this;
+    }
 
-    [[nodiscard]] auto error() const& -> const E& { return std::get<Err<E>>(data_).value; }
-    [[nodiscard]] auto error() && -> E { return std::move(std::get<Err<E>>(data_).value); }
+    ~Result()
+        requires trivially_destructible
+    = default;
+    ~Result() { destroy(); }
+
+    [[nodiscard]] auto is_ok() const -> bool { return is_ok_; }
+    [[nodiscard]] auto is_err() const -> bool { return !is_ok_; }
+
+    [[nodiscard]] auto value() & -> T& {
+        assert(is_ok_);
+        return value_;
+    }
+    [[nodiscard]] auto value() const& -> const T& {
+        assert(is_ok_);
+        return value_;
+    }
+    [[nodiscard]] auto value() && -> T {
+        assert(is_ok_);
+        return std::move(value_);
+    }
+
+    [[nodiscard]] auto error() & -> E& {
+        assert(!is_ok_);
+        return error_;
+    }
+    [[nodiscard]] auto error() const& -> const E& {
+        assert(!is_ok_);
+        return error_;
+    }
+    [[nodiscard]] auto error() && -> E {
+        assert(!is_ok_);
+        return std::move(error_);
+    }
 
     /**
      * @brief Transform the value if Ok, propagate error if Err
@@ -66,17 +154,17 @@ template <typename T, typename E = std::string> class Result {
     auto map(F&& f) const& -> Result<decltype(f(std::declval<const T&>())), E> {
         using U = decltype(f(std::declval<const T&>()));
         if (is_ok()) {
-            return Result<U, E>::ok(f(value()));
+            return Result<U, E>::ok(f(value_));
         }
-        return Result<U, E>::err(error());
+        return Result<U, E>::err(error_);
     }
 
     template <typename F> auto map(F&& f) && -> Result<decltype(f(std::declval<T>())), E> {
         using U = decltype(f(std::declval<T>()));
         if (is_ok()) {
-            return Result<U, E>::ok(f(std::move(*this).value()));
+            return Result<U, E>::ok(f(std::move(value_)));
         }
-        return Result<U, E>::err(std::move(*this).error());
+        return Result<U, E>::err(std::move(error_));
     }
 
     /**
@@ -86,9 +174,17 @@ template <typename T, typename E = std::string> class Result {
     auto map_err(F&& f) const& -> Result<T, decltype(f(std::declval<const E&>()))> {
         using U = decltype(f(std::declval<const E&>()));
         if (is_err()) {
-            return Result<T, U>::err(f(error()));
+            return Result<T, U>::err(f(error_));
         }
-        return Result<T, U>::ok(value());
+        return Result<T, U>::ok(value_);
+    }
+
+    template <typename F> auto map_err(F&& f) && -> Result<T, decltype(f(std::declval<E>()))> {
+        using U = decltype(f(std::declval<E>()));
+        if (is_err()) {
+            return Result<T, U>::err(f(std::move(error_)));
+        }
+        return Result<T, U>::ok(std::move(value_));
     }
 
     /**
@@ -97,17 +193,17 @@ template <typename T, typename E = std::string> class Result {
     template <typename F> auto and_then(F&& f) const& -> decltype(f(std::declval<const T&>())) {
         using R = decltype(f(std::declval<const T&>()));
         if (is_ok()) {
-            return f(value());
+            return f(value_);
         }
-        return R::err(error());
+        return R::err(error_);
     }
 
     template <typename F> auto and_then(F&& f) && -> decltype(f(std::declval<T>())) {
         using R = decltype(f(std::declval<T>()));
         if (is_ok()) {
-            return f(std::move(*this).value());
+            return f(std::move(value_));
         }
-        return R::err(std::move(*this).error());
+        return R::err(std::move(error_));
     }
 
     /**
@@ -117,14 +213,14 @@ template <typename T, typename E = std::string> class Result {
         if (is_ok()) {
             return *this;
         }
-        return f(error());
+        return f(error_);
     }
 
     template <typename F> auto or_else(F&& f) && -> Result<T, E> {
         if (is_ok()) {
             return std::move(*this);
         }
-        return f(std::move(*this).error());
+        return f(std::move(error_));
     }
 
     /**
@@ -132,14 +228,14 @@ template <typename T, typename E = std::string> class Result {
      */
     [[nodiscard]] auto value_or(T default_val) const& -> T {
         if (is_ok()) {
-            return value();
+            return value_;
         }
         return default_val;
     }
 
     [[nodiscard]] auto value_or(T default_val) && -> T {
         if (is_ok()) {
-            return std::move(*this).value();
+            return std::move(value_);
         }
         return default_val;
     }
@@ -147,24 +243,75 @@ template <typename T, typename E = std::string> class Result {
     /**
      * @brief Pattern matching style dispatch
      */
+    template <typename OnOk, typename OnErr>
+    auto match(OnOk&& on_ok, OnErr&& on_err) & -> decltype(on_ok(std::declval<T&>())) {
+        if (is_ok()) {
+            return on_ok(value_);
+        }
+        return on_err(error_);
+    }
+
     template <typename OnOk, typename OnErr>
     auto match(OnOk&& on_ok, OnErr&& on_err) const& -> decltype(on_ok(std::declval<const T&>())) {
         if (is_ok()) {
-            return on_ok(value());
+            return on_ok(value_);
         }
-        return on_err(error());
+        return on_err(error_);
     }
 
     template <typename OnOk, typename OnErr>
     auto match(OnOk&& on_ok, OnErr&& on_err) && -> decltype(on_ok(std::declval<T>())) {
         if (is_ok()) {
-            return on_ok(std::move(*this).value());
+            return on_ok(std::move(value_));
         }
-        return on_err(std::move(*this).error());
+        return on_err(std::move(error_));
     }
 
   private:
-    std::variant<Ok<T>, Err<E>> data_;
+    template <typename Other> void construct_from(Other&& other) {
+        if (is_ok_) {
+            std::construct_at(std::addressof(value_), std::forward<Other>(other).value_);
+        } else {
+            std::construct_at(std::addressof(error_), std::forward<Other>(other).error_);
+        }
+    }
+
+    // The old member is destroyed only once its replacement can no longer
+    // fail to construct, so a throwing copy or move leaves *this intact
+    template <typename Other> void assign_from(Other&& other) {
+        if constexpr (std::is_nothrow_move_constructible_v<T> &&
+                      std::is_nothrow_move_constructible_v<E>) {
+            Result incoming(std::forward<Other>(other));
+            destroy();
+            is_ok_ = incoming.is_ok_;
+            construct_from(std::move(incoming));
+        } else {
+            Result backup(std::move(*this));
+            destroy();
+            is_ok_ = other.is_ok_;
+            try {
+                construct_from(std::forward<Other>(other));
+            } catch (...) {
+                is_ok_ = backup.is_ok_;
+                construct_from(std::move(backup));
+                throw;
+            }
+        }
+    }
+
+    void destroy() {
+        if (is_ok_) {
+            std::destroy_at(std::addressof(value_));
+        } else {
+            std::destroy_at(std::addressof(error_));
+        }
+    }
+
+    union {
+        T value_;
+        E error_;
+    };
+    bool is_ok_;
 };
 
 } // namespace poolfactory
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <latch>
+#include <optional>
+#include <ranges>
+#include <stop_token>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "poolfactory/executor.hpp"
+#include "poolfactory/result.hpp"
+
+namespace poolfactory {
+
+namespace detail {
+
+template <typename R> struct ResultTraits {
+    static constexpr bool is_result = false;
+};
+
+template <typename T, typename E> struct ResultTraits<Result<T, E>> {
+    static constexpr bool is_result = true;
+    using value_type = T;
+    using error_type = E;
+};
+
+/**
+ * @brief Call f(args...), passing a trailing stop_token if f accepts one
+ */
+template <typename F, typename... Args>
+auto invoke_cancellable(F& f, std::stop_token token, Args&&... args) {
+    if constexpr (std::invocable<F&, Args..., std::stop_token>) {
+        return f(std::forward<Args>(args)..., std::move(token));
+    } else {
+        return f(std::forward<Args>(args)...);
+    }
+}
+
+template <typename F, typename... Args>
+using cancellable_result_t =
+    decltype(invoke_cancellable(std::declval<F&>(), std::stop_token{}, std::declval<Args>()...));
+
+template <typename F, typename... Args>
+using CancellableTraits = ResultTraits<cancellable_result_t<F, Args...>>;
+
+/**
+ * @brief Completion state shared by the tasks of one when_all/traverse call
+ *
+ * Lives on the caller's stack: the caller waits for every task to count down
+ * before returning, so tasks never outlive it. The first error wins, is
+ * stored once and requests stop; tasks that have not started by then are
+ * skipped, running ones see it through their stop_token. A task that throws
+ * fails the same way, and wait() rethrows its exception on the caller's
+ * thread.
+ */
+template <typename E> class JoinState {
+  public:
+    explicit JoinState(std::size_t tasks) : pending_(static_cast<std::ptrdiff_t>(tasks)) {}
+
+    JoinState(const JoinState&) = delete;
+    auto operator=(const JoinState&) -> JoinState& = delete;
+
+    template <typename Task, typename T> void run(Task& task, std::optional<T>& slot) {
+        if (!stop_.stop_requested()) {
+            try {
+                auto result = task(stop_.get_token());
+                if (result.is_ok()) {
+                    slot.emplace(std::move(result).value());
+                } else {
+                    fail(std::move(result).error());
+                }
+            } catch (...) {
+                // Must still count down, or the caller waits forever
+                fail_with(std::current_exception());
+            }
+        }
+        pending_.count_down();
+    }
+
+    // Block until every task has run or been skipped; returns the first
+    // error, or rethrows if the first failure was an exception
+    [[nodiscard]] auto wait() -> std::optional<E>& {
+        pending_.wait();
+        if (exception_) {
+            std::rethrow_exception(exception_);
+        }
+        return error_;
+    }
+
+  private:
+    void fail(E error) {
+        if (!failed_.exchange(true, std::memory_order_relaxed)) {
+            error_.emplace(std::move(error));
+            stop_.request_stop();
+        }
+    }
+
+    void fail_with(std::exception_ptr exception) {
+        if (!failed_.exchange(true, std::memory_order_relaxed)) {
+            exception_ = std::move(exception);
+            stop_.request_stop();
+        }
+    }
+
+    std::stop_source stop_;
+    std::latch pending_;
+    std::atomic<bool> failed_{false};
+    std::optional<E> error_;
+    std::exception_ptr exception_;
+};
+
+} // namespace detail
+
+/**
+ * @brief Turn a list of Results into a Result of a list (first error wins)
+ */
+template <typename T, typename E>
+auto sequence(std::vector<Result<T, E>> results) -> Result<std::vector<T>, E> {
+    std::vector<T> values;
+    values.reserve(results.size());
+    for (auto& result : results) {
+        if (result.is_err()) {
+            return Result<std::vector<T>, E>::err(std::move(result).error());
+        }
+        values.push_back(std::move(result).value());
+    }
+    return Result<std::vector<T>, E>::ok(std::move(values));
+}
+
+/**
+ * @brief Apply a fallible f to each input in order, stopping at the first error
+ *
+ * f is not called for the inputs after the one that failed.
+ */
+template <std::ranges::input_range R, typename F>
+    requires detail::ResultTraits<std::invoke_result_t<F&, std::ranges::range_reference_t<R>>>::
+        is_result
+auto traverse(R&& inputs, F&& f) {
+    using Traits =
+        detail::ResultTraits<std::invoke_result_t<F&, std::ranges::range_reference_t<R>>>;
+    using Out = Result<std::vector<typename Traits::value_type>, typename Traits::error_type>;
+
+    std::vector<typename Traits::value_type> values;
+    if constexpr (std::ranges::sized_range<R>) {
+        values.reserve(std::ranges::size(inputs));
+    }
+    for (auto&& input : inputs) {
+        auto result = f(std::forward<decltype(input)>(input));
+        if (result.is_err()) {
+            return Out::err(std::move(result).error());
+        }
+        values.push_back(std::move(result).value());
+    }
+    return Out::ok(std::move(values));
+}
+
+/**
+ * @brief Parallel traverse: f runs for every input concurrently on `executor`
+ *
+ * f may take a trailing std::stop_token; it is signalled when another input
+ * fails, and inputs not yet started are skipped. Returns once every task has
+ * finished or been skipped, so f and the inputs may live on the caller's
+ * stack. f is called concurrently and must be safe to share. If f throws,
+ * the rest is cancelled as for an error and the exception is rethrown here.
+ */
+template <Executor Ex, std::ranges::random_access_range R, typename F>
+    requires std::ranges::sized_range<R> &&
+             detail::CancellableTraits<F, std::ranges::range_reference_t<R>>::is_result
+auto traverse(Ex& executor, R&& inputs, F&& f) {
+    using Traits = detail::CancellableTraits<F, std::ranges::range_reference_t<R>>;
+    using T = typename Traits::value_type;
+    using E = typename Traits::error_type;
+
+    auto count = static_cast<std::size_t>(std::ranges::size(inputs));
+    std::vector<std::optional<T>> slots(count);
+    detail::JoinState<E> state(count);
+
+    auto first = std::ranges::begin(inputs);
+    for (std::size_t i = 0; i < count; ++i) {
+        executor.execute([&state, &slots, &f, first, i] {
+            auto task = [&](std::stop_token token) {
+                return detail::invoke_cancellable(f, std::move(token), first[i]);
+            };
+            state.run(task, slots[i]);
+        });
+    }
+
+    if (auto& error = state.wait()) {
+        return Result<std::vector<T>, E>::err(std::move(*error));
+    }
+    std::vector<T> values;
+    values.reserve(count);
+    for (auto& slot : slots) {
+        values.push_back(std::move(*slot));
+    }
+    return Result<std::vector<T>, E>::ok(std::move(values));
+}
+
+/**
+ * @brief Run independent fallible operations concurrently and combine them
+ *
+ * Each f is `() -> Result<Ti, E>` or `(std::stop_token) -> Result<Ti, E>`,
+ * all with the same E. On the first error the remaining operations are
+ * cancelled (skipped if not started, stop_token signalled if running) and
+ * that error is returned; otherwise the values are returned in argument order.
+ * An operation that throws cancels the rest the same way; the exception is
+ * rethrown here once every operation has finished.
+ *
+ * Usage:
+ *   ThreadPoolExecutor executor(2);
+ *   auto both = when_all(executor,
+ *       [&] { return users->with_resource(load_user); },
+ *       [&] { return orders->with_resource(load_orders); });
+ */
+template <Executor Ex, typename... Fs>
+    requires(sizeof...(Fs) > 0 && (detail::CancellableTraits<Fs>::is_result && ...))
+auto when_all(Ex& executor, Fs&&... fs) {
+    using E = typename detail::CancellableTraits<std::tuple_element_t<0, std::tuple<Fs...>>>::
+        error_type;
+    static_assert((std::same_as<typename detail::CancellableTraits<Fs>::error_type, E> && ...),
+                  "when_all: every operation must share the same error type");
+    using Values = std::tuple<typename detail::CancellableTraits<Fs>::value_type...>;
+
+    std::tuple<std::optional<typename detail::CancellableTraits<Fs>::value_type>...> slots;
+    detail::JoinState<E> state(sizeof...(Fs));
+    auto ops = std::tie(fs...);
+
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (executor.execute([&state, &slots, &ops] {
+             auto task = [&](std::stop_token token) {
+                 return detail::invoke_cancellable(std::get<I>(ops), std::move(token));
+             };
+             state.run(task, std::get<I>(slots));
+         }),
+         ...);
+    }(std::index_sequence_for<Fs...>{});
+
+    if (auto& error = state.wait()) {
+        return Result<Values, E>::err(std::move(*error));
+    }
+    return std::apply(
+        [](auto&... slot) { return Result<Values, E>::ok(Values{std::move(*slot)...}); }, slots);
+}
+
+} // namespace poolfactory
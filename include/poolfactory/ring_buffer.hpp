@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <utility>
+
+#include "poolfactory/poison.hpp"
+
+namespace poolfactory {
+
+/**
+ * @brief Fixed-capacity FIFO queue with storage allocated once up front
+ *
+ * Replaces std::deque for a pool's idle list: the buffer is sized to the
+ * pool's max_size at construction, so push_back/pop_front never touch the
+ * allocator afterwards. Pushing into a full buffer is a precondition
+ * violation; pools never hold more than max_size idle resources.
+ *
+ * Elements are idle resources: with POOLFACTORY_POISON_IDLE they stay
+ * poisoned while stored and are only reachable through take_front().
+ */
+template <typename T> class RingBuffer {
+  public:
+    explicit RingBuffer(std::size_t capacity)
+        : storage_(capacity == 0 ? nullptr : allocator_.allocate(capacity)), capacity_(capacity) {}
+
+    RingBuffer(const RingBuffer&) = delete;
+    auto operator=(const RingBuffer&) -> RingBuffer& = delete;
+    RingBuffer(RingBuffer&&) = delete;
+    auto operator=(RingBuffer&&) -> RingBuffer& = delete;
+
+    ~RingBuffer() {
+        clear();
+        if (storage_ != nullptr) {
+            allocator_.deallocate(storage_, capacity_);
+        }
+    }
+
+    void push_back(T value) { emplace_back(std::move(value)); }
+
+    template <typename... Args> void emplace_back(Args&&... args) {
+        auto index = wrap(head_ + size_);
+        T* slot = ::new (static_cast<void*>(storage_ + index)) T(std::forward<Args>(args)...);
+        detail::poison_idle(*slot);
+        ++size_;
+    }
+
+    // Move the oldest element out and remove it
+    [[nodiscard]] auto take_front() -> T {
+        detail::unpoison_idle(storage_[head_]);
+        T value = std::move(storage_[head_]);
+        std::destroy_at(storage_ + head_);
+        head_ = wrap(head_ + 1);
+        --size_;
+        return value;
+    }
+
+    /**
+     * @brief Move out the oldest element satisfying pred, if any
+     *
+     * O(size). The oldest element moves into the gap, so the remaining
+     * order is FIFO except for that one element.
+     */
+    template <typename Pred> [[nodiscard]] auto take_first_if(Pred&& pred) -> std::optional<T> {
+        for (std::size_t i = 0; i < size_; ++i) {
+            T* slot = storage_ + wrap(head_ + i);
+            detail::unpoison_idle(*slot);
+            if (!pred(std::as_const(*slot))) {
+                detail::poison_idle(*slot);
+                continue;
+            }
+
+            std::optional<T> value(std::move(*slot));
+            std::destroy_at(slot);
+            if (i != 0) {
+                detail::unpoison_idle(storage_[head_]);
+                ::new (static_cast<void*>(slot)) T(std::move(storage_[head_]));
+                std::destroy_at(storage_ + head_);
+                detail::poison_idle(*slot);
+            }
+            head_ = wrap(head_ + 1);
+            --size_;
+            return value;
+        }
+        return std::nullopt;
+    }
+
+    void pop_front() {
+        detail::unpoison_idle(storage_[head_]);
+        std::destroy_at(storage_ + head_);
+        head_ = wrap(head_ + 1);
+        --size_;
+    }
+
+    void clear() {
+        while (size_ > 0) {
+            pop_front();
+        }
+        head_ = 0;
+    }
+
+    [[nodiscard]] auto empty() const -> bool { return size_ == 0; }
+    [[nodiscard]] auto full() const -> bool { return size_ == capacity_; }
+    [[nodiscard]] auto size() const -> std::size_t { return size_; }
+    [[nodiscard]] auto capacity() const -> std::size_t { return capacity_; }
+
+  private:
+    // Indices stay below 2 * capacity, so one compare replaces a modulo
+    [[nodiscard]] auto wrap(std::size_t index) const -> std::size_t {
+        return index >= capacity_ ? index - capacity_ : index;
+    }
+
+    [[no_unique_address]] std::allocator<T> allocator_;
+    T* storage_;
+    std::size_t capacity_;
+    std::size_t head_{0};
+    std::size_t size_{0};
+};
+
+} // namespace poolfactory
@@ -0,0 +1,300 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "poolfactory/cache_line.hpp"
+#include "poolfactory/concepts.hpp"
+#include "poolfactory/fast_random.hpp"
+#include "poolfactory/pool.hpp"
+#include "poolfactory/pool_config.hpp"
+#include "poolfactory/pool_error.hpp"
+#include "poolfactory/result.hpp"
+#include "poolfactory/unit.hpp"
+
+namespace poolfactory {
+
+// Forward declarations
+class PoolFactory;
+template <Poolable T> class SharedLeasePool;
+
+/**
+ * @brief One lease on a shared resource
+ *
+ * Like PooledResource, but other leases may use the same resource at the
+ * same time. Non-copyable, movable; the lease is returned on destruction.
+ */
+template <Poolable T> class SharedLease {
+  public:
+    SharedLease(const SharedLease&) = delete;
+    auto operator=(const SharedLease&) -> SharedLease& = delete;
+
+    SharedLease(SharedLease&& other) noexcept
+        : pool_(std::exchange(other.pool_, nullptr)), slot_(other.slot_) {}
+
+    auto operator=(SharedLease&& other) noexcept -> SharedLease& {
+        if (this != &other) {
+            release();
+            pool_ = std::exchange(other.pool_, nullptr);
+            slot_ = other.slot_;
+        }
+        return *this;
+    }
+
+    ~SharedLease() { release(); }
+
+    [[nodiscard]] auto get() const -> T& { return pool_->resource(slot_); }
+
+    auto operator->() const -> T* { return &get(); }
+    auto operator*() const -> T& { return get(); }
+
+    [[nodiscard]] auto has_value() const -> bool { return pool_ != nullptr; }
+    explicit operator bool() const { return has_value(); }
+
+  private:
+    friend class SharedLeasePool<T>;
+
+    SharedLease(SharedLeasePool<T>* pool, std::size_t slot) : pool_(pool), slot_(slot) {}
+
+    void release() {
+        if (pool_ != nullptr) {
+            std::exchange(pool_, nullptr)->release_lease(slot_);
+        }
+    }
+
+    SharedLeasePool<T>* pool_;
+    std::size_t slot_;
+};
+
+/**
+ * @brief Pool whose resources serve up to `max_leases` borrowers at once
+ *
+ * For multiplexed resources (HTTP/2 or RPC channels) that handle many
+ * concurrent requests. Acquire leases the less loaded of two randomly
+ * chosen resources (power of two choices), falls back to a scan when both
+ * are full, and creates a new resource only when every existing one is at
+ * `max_leases`; once max_size resources exist it waits up to
+ * acquire_timeout. Resources are never reset or destroyed while the pool
+ * lives, and T must be safe to use from several threads at once.
+ *
+ * Leasing is lock-free (one CAS on the resource's counter); the mutex only
+ * guards creation and waiting.
+ */
+template <Poolable T> class SharedLeasePool {
+  public:
+    using Factory = std::function<Result<T>()>;
+
+    SharedLeasePool(const SharedLeasePool&) = delete;
+    auto operator=(const SharedLeasePool&) -> SharedLeasePool& = delete;
+    SharedLeasePool(SharedLeasePool&&) = delete;
+    auto operator=(SharedLeasePool&&) -> SharedLeasePool& = delete;
+
+    ~SharedLeasePool() = default;
+
+    /**
+     * @brief Lease a resource, blocking until one has room or timeout
+     */
+    [[nodiscard]] auto acquire() -> PoolResult<SharedLease<T>> {
+        auto slot = acquire_slot();
+        if (slot.is_err()) {
+            return PoolResult<SharedLease<T>>::err(std::move(slot).error());
+        }
+        return PoolResult<SharedLease<T>>::ok(SharedLease<T>(this, slot.value()));
+    }
+
+    /**
+     * @brief Execute function with a leased resource (bracket pattern)
+     */
+    template <typename F>
+    auto with_resource(F&& f)
+        -> PoolResult<std::conditional_t<std::is_void_v<std::invoke_result_t<F, T&>>,
+                                         Unit,
+                                         std::invoke_result_t<F, T&>>> {
+        using RawR = std::invoke_result_t<F, T&>;
+        using R = std::conditional_t<std::is_void_v<RawR>, Unit, RawR>;
+
+        auto slot = acquire_slot();
+        if (slot.is_err()) {
+            return PoolResult<R>::err(std::move(slot).error());
+        }
+
+        SharedLease<T> lease(this, slot.value());
+        if constexpr (std::is_void_v<RawR>) {
+            f(*lease);
+            return PoolResult<R>::ok(unit);
+        } else {
+            return PoolResult<R>::ok(f(*lease));
+        }
+    }
+
+    /**
+     * @brief Pool statistics; a resource with any lease counts as in use
+     */
+    [[nodiscard]] auto stats() const -> PoolStats {
+        auto created = created_.load(std::memory_order_acquire);
+        std::size_t busy = 0;
+        for (std::size_t i = 0; i < created; ++i) {
+            busy += slots_[i].leases.load(std::memory_order_relaxed) > 0 ? 1 : 0;
+        }
+        return PoolStats{
+            .available = created - busy,
+            .in_use = busy,
+            .total_created = created,
+            .max_size = config_.max_size,
+        };
+    }
+
+    /**
+     * @brief Leases currently held across all resources
+     */
+    [[nodiscard]] auto active_leases() const -> std::size_t {
+        auto created = created_.load(std::memory_order_acquire);
+        std::size_t leases = 0;
+        for (std::size_t i = 0; i < created; ++i) {
+            leases += slots_[i].leases.load(std::memory_order_relaxed);
+        }
+        return leases;
+    }
+
+    [[nodiscard]] auto max_leases() const -> std::size_t { return max_leases_; }
+
+    [[nodiscard]] auto config() const -> const PoolConfig& { return config_; }
+
+  private:
+    friend class PoolFactory;
+    friend class SharedLease<T>;
+
+    // One line per resource: lease counters of neighbours never share a line
+    struct alignas(cache_line_size) Slot {
+        std::atomic<std::size_t> leases{0};
+        std::optional<T> resource;
+
+        auto try_lease(std::size_t limit) -> bool {
+            // seq_cst, not relaxed: pairs with the waiter count in release_lease
+            auto current = leases.load();
+            while (current < limit) {
+                if (leases.compare_exchange_weak(current, current + 1)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    SharedLeasePool(Factory factory, std::size_t max_leases, PoolConfig config)
+        : factory_(std::move(factory)), max_leases_(max_leases), config_(config),
+          slots_(std::make_unique<Slot[]>(config.max_size)) {
+        // Pre-warm pool to min_size
+        std::lock_guard lock(mutex_);
+        for (std::size_t i = 0; i < config_.min_size; ++i) {
+            if (create_locked(0).is_err()) {
+                break;
+            }
+        }
+    }
+
+    auto resource(std::size_t slot) const -> T& { return *slots_[slot].resource; }
+
+    void release_lease(std::size_t slot) {
+        slots_[slot].leases.fetch_sub(1);
+        // Only take the lock when someone may be blocked on it
+        if (waiters_.load() > 0) {
+            { std::lock_guard lock(mutex_); }
+            cv_.notify_one();
+        }
+    }
+
+    auto acquire_slot() -> PoolResult<std::size_t> {
+        if (auto slot = try_lease()) {
+            return PoolResult<std::size_t>::ok(*slot);
+        }
+
+        std::unique_lock lock(mutex_);
+        auto deadline = std::chrono::steady_clock::now() + config_.acquire_timeout;
+
+        // Registered before the retry below: a release that misses the
+        // retry sees the waiter and notifies
+        waiters_.fetch_add(1);
+        auto result = [&]() -> PoolResult<std::size_t> {
+            while (true) {
+                if (auto slot = try_lease()) {
+                    return PoolResult<std::size_t>::ok(*slot);
+                }
+                if (created_.load(std::memory_order_relaxed) < config_.max_size) {
+                    return create_locked(1);
+                }
+                if (cv_.wait_until(lock, deadline) == std::cv_status::timeout) {
+                    if (auto slot = try_lease()) {
+                        return PoolResult<std::size_t>::ok(*slot);
+                    }
+                    return PoolResult<std::size_t>::err(PoolErrc::timeout);
+                }
+            }
+        }();
+        waiters_.fetch_sub(1);
+        return result;
+    }
+
+    // Power of two choices, then a scan from a random start
+    auto try_lease() -> std::optional<std::size_t> {
+        auto created = created_.load(std::memory_order_acquire);
+        if (created == 0) {
+            return std::nullopt;
+        }
+
+        auto a = detail::fast_random() % created;
+        auto b = detail::fast_random() % created;
+        auto pick = slots_[a].leases.load(std::memory_order_relaxed) <=
+                            slots_[b].leases.load(std::memory_order_relaxed)
+                        ? a
+                        : b;
+        if (slots_[pick].try_lease(max_leases_)) {
+            return pick;
+        }
+
+        for (std::size_t i = 0; i < created; ++i) {
+            auto slot = (pick + i) % created;
+            if (slots_[slot].try_lease(max_leases_)) {
+                return slot;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // Caller holds mutex_; publishes the new resource with `leases` taken
+    auto create_locked(std::size_t leases) -> PoolResult<std::size_t> {
+        auto result = factory_();
+        if (result.is_err()) {
+            return PoolResult<std::size_t>::err(
+                PoolError(PoolErrc::factory_failed, std::move(result).error()));
+        }
+
+        auto index = created_.load(std::memory_order_relaxed);
+        slots_[index].resource.emplace(std::move(result).value());
+        slots_[index].leases.store(leases, std::memory_order_relaxed);
+        created_.store(index + 1, std::memory_order_release);
+        return PoolResult<std::size_t>::ok(index);
+    }
+
+    Factory factory_;
+    std::size_t max_leases_;
+    PoolConfig config_;
+
+    // Preallocated to max_size; slots below created_ hold a resource
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<std::size_t> created_{0};
+
+    alignas(cache_line_size) std::mutex mutex_;
+    std::condition_variable cv_;
+    std::atomic<std::size_t> waiters_{0};
+};
+
+} // namespace poolfactory
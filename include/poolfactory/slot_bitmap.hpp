@@ -0,0 +1,157 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace poolfactory {
+
+/**
+ * @brief Search strategy for SlotBitmap::find_first()
+ *
+ * flat         - scan the bit words (tzcnt per word, 256/512-bit SIMD
+ *                skipping of empty words when AVX2/AVX-512 is enabled)
+ * hierarchical - keep one summary bit per non-empty word (two levels),
+ *                so find_first is three tzcnt regardless of N
+ */
+enum class SlotIndex { flat, hierarchical };
+
+inline constexpr std::size_t max_hierarchical_slots = std::size_t{64} * 64 * 64;
+
+/**
+ * @brief Fixed-size set of slot indices, 0..N-1
+ *
+ * Used as a free-slot index: set bits are free slots, find_first() returns
+ * the lowest one (or N when none). Hierarchical mode supports up to 256k
+ * slots with O(1) lookup; summaries cost one extra word per 4096 slots.
+ */
+template <std::size_t N, SlotIndex Index = (N > 1024 ? SlotIndex::hierarchical : SlotIndex::flat)>
+class SlotBitmap {
+  public:
+    static_assert(N > 0, "SlotBitmap cannot be empty");
+    static_assert(Index == SlotIndex::flat || N <= max_hierarchical_slots,
+                  "hierarchical SlotBitmap supports at most 256k slots");
+
+    static constexpr std::size_t size = N;
+
+    constexpr void set(std::size_t i) {
+        auto w = i / word_bits;
+        words_[w] |= bit(i);
+        if constexpr (Index == SlotIndex::hierarchical) {
+            summary_.words[w / word_bits] |= bit(w);
+            summary_.top |= bit(w / word_bits);
+        }
+    }
+
+    constexpr void reset(std::size_t i) {
+        auto w = i / word_bits;
+        words_[w] &= ~bit(i);
+        if constexpr (Index == SlotIndex::hierarchical) {
+            if (words_[w] == 0) {
+                auto s = w / word_bits;
+                summary_.words[s] &= ~bit(w);
+                if (summary_.words[s] == 0) {
+                    summary_.top &= ~bit(s);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr auto test(std::size_t i) const -> bool {
+        return (words_[i / word_bits] & bit(i)) != 0;
+    }
+
+    constexpr void set_all() {
+        for (std::size_t i = 0; i < N; ++i) {
+            set(i);
+        }
+    }
+
+    /**
+     * @brief Lowest set index, or N when the set is empty
+     */
+    [[nodiscard]] auto find_first() const -> std::size_t {
+        if constexpr (Index == SlotIndex::hierarchical) {
+            if (summary_.top == 0) {
+                return N;
+            }
+            auto s = ctz(summary_.top);
+            auto w = s * word_bits + ctz(summary_.words[s]);
+            return w * word_bits + ctz(words_[w]);
+        } else {
+            auto w = first_nonzero_word();
+            return w < word_count ? w * word_bits + ctz(words_[w]) : N;
+        }
+    }
+
+    [[nodiscard]] constexpr auto count() const -> std::size_t {
+        std::size_t total = 0;
+        for (auto word : words_) {
+            total += static_cast<std::size_t>(std::popcount(word));
+        }
+        return total;
+    }
+
+    [[nodiscard]] auto any() const -> bool { return find_first() < N; }
+
+  private:
+    static constexpr std::size_t word_bits = 64;
+    static constexpr std::size_t word_count = (N + word_bits - 1) / word_bits;
+    static constexpr std::size_t summary_count = (word_count + word_bits - 1) / word_bits;
+
+    static constexpr auto bit(std::size_t i) -> std::uint64_t {
+        return std::uint64_t{1} << (i % word_bits);
+    }
+
+    static constexpr auto ctz(std::uint64_t word) -> std::size_t {
+        return static_cast<std::size_t>(std::countr_zero(word));
+    }
+
+    // Index of the first non-zero word, or word_count
+    [[nodiscard]] auto first_nonzero_word() const -> std::size_t {
+        std::size_t w = 0;
+#if defined(__AVX512F__)
+        for (; w + 8 <= word_count; w += 8) {
+            auto block = _mm512_loadu_si512(static_cast<const void*>(&words_[w]));
+            auto mask = _mm512_test_epi64_mask(block, block);
+            if (mask != 0) {
+                return w + ctz(mask);
+            }
+        }
+#elif defined(__AVX2__)
+        for (; w + 4 <= word_count; w += 4) {
+            auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&words_[w]));
+            if (!_mm256_testz_si256(block, block)) {
+                break;
+            }
+        }
+#endif
+        for (; w < word_count; ++w) {
+            if (words_[w] != 0) {
+                return w;
+            }
+        }
+        return word_count;
+    }
+
+    std::array<std::uint64_t, word_count> words_{};
+
+    // Hierarchical mode only: bit w of words is set iff words_[w] != 0,
+    // bit s of top is set iff words[s] != 0
+    struct Summary {
+        std::array<std::uint64_t, summary_count> words{};
+        std::uint64_t top{0};
+    };
+    struct NoSummary {};
+
+    [[no_unique_address]] std::conditional_t<Index == SlotIndex::hierarchical, Summary, NoSummary>
+        summary_{};
+};
+
+} // namespace poolfactory
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+namespace poolfactory {
+
+/**
+ * @brief Whether pools verify SlotHandles before using them
+ *
+ * On by default in debug builds, off under NDEBUG, where get/release compile
+ * down to an index. Define POOLFACTORY_CHECK_HANDLES to 0 or 1 to override.
+ * Slot generations are maintained either way, so the setting does not
+ * change any layout and may differ between translation units.
+ */
+#if !defined(POOLFACTORY_CHECK_HANDLES)
+#if defined(NDEBUG)
+#define POOLFACTORY_CHECK_HANDLES 0
+#else
+#define POOLFACTORY_CHECK_HANDLES 1
+#endif
+#endif
+
+inline constexpr bool check_handles = POOLFACTORY_CHECK_HANDLES != 0;
+
+/**
+ * @brief Non-owning reference to a pool slot: index plus generation
+ *
+ * A slot's generation is bumped on every acquire and every release (odd
+ * while checked out), so a handle is live only while its generation matches
+ * the slot's. Stale handles are detected in O(1) without touching the
+ * resource. Generations wrap after 2^31 reuses of the same slot.
+ */
+struct SlotHandle {
+    std::uint32_t index{0};
+    std::uint32_t generation{0};
+
+    constexpr auto operator==(const SlotHandle&) const -> bool = default;
+};
+
+namespace detail {
+
+[[noreturn]] inline void stale_handle(const char* operation, SlotHandle handle) {
+    std::fprintf(stderr,
+                 "poolfactory: %s on stale SlotHandle (index %u, generation %u)\n",
+                 operation,
+                 static_cast<unsigned>(handle.index),
+                 static_cast<unsigned>(handle.generation));
+    std::abort();
+}
+
+[[noreturn]] inline void pool_destroyed_in_use(std::size_t in_use) {
+    std::fprintf(
+        stderr, "poolfactory: StaticPool destroyed with checked-out slots (%zu)\n", in_use);
+    std::abort();
+}
+
+} // namespace detail
+
+} // namespace poolfactory
@@ -0,0 +1,477 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "poolfactory/concepts.hpp"
+#include "poolfactory/emplacer.hpp"
+#include "poolfactory/pool.hpp"
+#include "poolfactory/pool_error.hpp"
+#include "poolfactory/poison.hpp"
+#include "poolfactory/result.hpp"
+#include "poolfactory/slot_bitmap.hpp"
+#include "poolfactory/slot_handle.hpp"
+#include "poolfactory/unit.hpp"
+
+namespace poolfactory {
+
+/**
+ * @brief Compile-time configuration for StaticPool
+ *
+ * Structural type, so it can be passed as a template argument.
+ * Capacity is the pool's N template parameter; there is no timeout
+ * because a StaticPool never blocks.
+ */
+struct StaticPoolConfig {
+    std::size_t min_size{0};
+    bool validate_on_acquire{true};
+    bool validate_on_release{false};
+
+    [[nodiscard]] constexpr auto with_min_size(std::size_t n) const -> StaticPoolConfig {
+        auto copy = *this;
+        copy.min_size = n;
+        return copy;
+    }
+
+    [[nodiscard]] constexpr auto with_validation(bool on_acquire, bool on_release) const
+        -> StaticPoolConfig {
+        auto copy = *this;
+        copy.validate_on_acquire = on_acquire;
+        copy.validate_on_release = on_release;
+        return copy;
+    }
+
+    constexpr auto operator==(const StaticPoolConfig&) const -> bool = default;
+};
+
+inline constexpr StaticPoolConfig default_static_config{};
+
+namespace detail {
+
+struct AlwaysValid {
+    template <typename T> constexpr auto operator()(const T&) const -> bool { return true; }
+};
+
+struct NoReset {
+    template <typename T> auto operator()(T&) const -> Result<Unit> {
+        return Result<Unit>::ok(unit);
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief RAII handle into a StaticPool slot
+ *
+ * One pointer wide: the slot records its owning pool, so the handle only
+ * needs the slot address. Non-copyable, movable.
+ */
+template <typename PoolT> class StaticPooledResource {
+  public:
+    using value_type = typename PoolT::value_type;
+
+    StaticPooledResource(const StaticPooledResource&) = delete;
+    auto operator=(const StaticPooledResource&) -> StaticPooledResource& = delete;
+
+    StaticPooledResource(StaticPooledResource&& other) noexcept
+        : slot_(std::exchange(other.slot_, nullptr)) {}
+
+    auto operator=(StaticPooledResource&& other) noexcept -> StaticPooledResource& {
+        if (this != &other) {
+            release();
+            slot_ = std::exchange(other.slot_, nullptr);
+        }
+        return *this;
+    }
+
+    ~StaticPooledResource() { release(); }
+
+    // Access the underlying resource
+    [[nodiscard]] auto get() const -> const value_type& { return *slot_->object(); }
+    [[nodiscard]] auto get() -> value_type& { return *slot_->object(); }
+
+    auto operator->() -> value_type* { return slot_->object(); }
+    auto operator->() const -> const value_type* { return slot_->object(); }
+    auto operator*() -> value_type& { return *slot_->object(); }
+    auto operator*() const -> const value_type& { return *slot_->object(); }
+
+    [[nodiscard]] auto has_value() const -> bool { return slot_ != nullptr; }
+    explicit operator bool() const { return has_value(); }
+
+    /**
+     * @brief Non-owning SlotHandle to this slot; goes stale once this handle releases
+     *
+     * An empty (moved-from) handle yields SlotHandle{}, which is never live.
+     */
+    [[nodiscard]] auto slot_handle() const -> SlotHandle {
+        return slot_ != nullptr ? slot_->owner->handle_of(*slot_) : SlotHandle{};
+    }
+
+    /**
+     * @brief Apply a function to the resource (functor-style)
+     */
+    template <typename F>
+    auto use(F&& f) const -> decltype(f(std::declval<const value_type&>())) {
+        return f(get());
+    }
+
+    template <typename F> auto use(F&& f) -> decltype(f(std::declval<value_type&>())) {
+        return f(get());
+    }
+
+  private:
+    friend PoolT;
+
+    using Slot = typename PoolT::Slot;
+
+    explicit StaticPooledResource(Slot* slot) : slot_(slot) {}
+
+    // Give up ownership without releasing (acquire_handle)
+    auto detach() -> Slot* { return std::exchange(slot_, nullptr); }
+
+    void release() {
+        if (slot_ != nullptr) {
+            slot_->owner->release_slot(*slot_);
+            slot_ = nullptr;
+        }
+    }
+
+    Slot* slot_;
+};
+
+/**
+ * @brief Fixed-capacity, heap-free resource pool
+ *
+ * Resources are constructed lazily into N inline slots. Free state lives in
+ * two SlotBitmaps (idle = constructed and free, vacant = never constructed
+ * or discarded), so acquire is a find-first-set: a SIMD word scan for small
+ * N, constant-time summary lookup for large N.
+ * Lifecycle hooks are stored by value and checked with the same concepts as
+ * PoolFactory; stateless hooks take no space. The factory is either a
+ * ResourceFactory or a ResourceEmplacer; the latter constructs T straight
+ * into its slot, so T is never moved and need not be movable.
+ *
+ * Besides RAII handles, slots can be checked out as SlotHandles
+ * (acquire_handle/get/release): plain index + generation pairs for code that
+ * keeps references outside an owning handle. Stale handles are caught in
+ * debug builds (see POOLFACTORY_CHECK_HANDLES), and so is destroying the
+ * pool before every handle and slot has been released.
+ *
+ * Not thread-safe, never blocks, never allocates.
+ */
+template <std::destructible T,
+          std::size_t N,
+          typename Factory,
+          typename Validator = detail::AlwaysValid,
+          typename Resetter = detail::NoReset,
+          StaticPoolConfig Config = default_static_config>
+    requires(ResourceFactory<Factory, T> || ResourceEmplacer<Factory, T>) &&
+            ResourceValidator<Validator, T> && ResourceResetter<Resetter, T>
+class StaticPool {
+  public:
+    using value_type = T;
+    using Handle = StaticPooledResource<StaticPool>;
+
+    static_assert(N > 0, "StaticPool capacity cannot be 0");
+    static_assert(Config.min_size <= N, "min_size cannot exceed capacity");
+    static_assert(N <= std::numeric_limits<std::uint32_t>::max(), "capacity must fit a SlotHandle");
+
+    static constexpr std::size_t capacity = N;
+    static constexpr StaticPoolConfig config = Config;
+
+    explicit StaticPool(Factory factory, Validator validator = {}, Resetter resetter = {})
+        : factory_(std::move(factory)), validator_(std::move(validator)),
+          resetter_(std::move(resetter)) {
+        static_assert(sizeof(Handle) == sizeof(void*), "handle must stay one pointer wide");
+
+        for (auto& slot : slots_) {
+            slot.owner = this;
+        }
+        vacant_.set_all();
+
+        // Pre-warm pool to min_size
+        for (std::size_t i = 0; i < Config.min_size; ++i) {
+            if (construct_in(i).is_ok()) {
+                vacant_.reset(i);
+                idle_.set(i);
+                detail::poison_idle(*slots_[i].object());
+            }
+        }
+    }
+
+    StaticPool(const StaticPool&) = delete;
+    auto operator=(const StaticPool&) -> StaticPool& = delete;
+    StaticPool(StaticPool&&) = delete;
+    auto operator=(StaticPool&&) -> StaticPool& = delete;
+
+    // Every handle must be released first: slots live inside the pool
+    ~StaticPool() {
+        if constexpr (check_handles) {
+            if (in_use_ != 0) {
+                detail::pool_destroyed_in_use(in_use_);
+            }
+        }
+        for (std::size_t i = 0; i < N; ++i) {
+            if (idle_.test(i)) {
+                detail::unpoison_idle(*slots_[i].object());
+            }
+            if (!vacant_.test(i)) {
+                slots_[i].object()->~T();
+            }
+        }
+    }
+
+    /**
+     * @brief Acquire a resource from the pool
+     */
+    [[nodiscard]] auto acquire() -> PoolResult<Handle> {
+        if (auto index = idle_.find_first(); index < N) {
+            idle_.reset(index);
+            detail::unpoison_idle(*slots_[index].object());
+
+            // Validate if configured
+            if (Config.validate_on_acquire && !validator_(*slots_[index].object())) {
+                // Resource invalid, construct a fresh one in its place
+                slots_[index].object()->~T();
+                return create_in(index);
+            }
+
+            return PoolResult<Handle>::ok(check_out(index));
+        }
+
+        // Need to create new resource
+        auto index = vacant_.find_first();
+        if (index >= N) {
+            return PoolResult<Handle>::err(PoolErrc::exhausted);
+        }
+
+        vacant_.reset(index);
+        return create_in(index);
+    }
+
+    /**
+     * @brief Acquire a resource as a SlotHandle; it must be given back via release()
+     */
+    [[nodiscard]] auto acquire_handle() -> PoolResult<SlotHandle> {
+        auto acquired = acquire();
+        if (acquired.is_err()) {
+            return PoolResult<SlotHandle>::err(std::move(acquired).error());
+        }
+        Slot* slot = std::move(acquired).value().detach();
+        return PoolResult<SlotHandle>::ok(handle_of(*slot));
+    }
+
+    /**
+     * @brief Access a checked-out slot (checked only when check_handles)
+     */
+    [[nodiscard]] auto get(SlotHandle handle) -> T& {
+        if constexpr (check_handles) {
+            if (!is_live(handle)) {
+                detail::stale_handle("get", handle);
+            }
+        }
+        return *slots_[handle.index].object();
+    }
+
+    [[nodiscard]] auto get(SlotHandle handle) const -> const T& {
+        if constexpr (check_handles) {
+            if (!is_live(handle)) {
+                detail::stale_handle("get", handle);
+            }
+        }
+        return *slots_[handle.index].object();
+    }
+
+    /**
+     * @brief Access a slot if the handle is still live, nullptr otherwise (always checked)
+     */
+    [[nodiscard]] auto try_get(SlotHandle handle) -> T* {
+        return is_live(handle) ? slots_[handle.index].object() : nullptr;
+    }
+
+    [[nodiscard]] auto try_get(SlotHandle handle) const -> const T* {
+        return is_live(handle) ? slots_[handle.index].object() : nullptr;
+    }
+
+    [[nodiscard]] auto is_live(SlotHandle handle) const -> bool {
+        return handle.index < N && (handle.generation & 1U) != 0 &&
+               slots_[handle.index].generation == handle.generation;
+    }
+
+    /**
+     * @brief Give back a slot checked out with acquire_handle()
+     *
+     * Releasing twice is caught when check_handles, undefined otherwise.
+     */
+    void release(SlotHandle handle) {
+        if constexpr (check_handles) {
+            if (!is_live(handle)) {
+                detail::stale_handle("release", handle);
+            }
+        }
+        release_slot(slots_[handle.index]);
+    }
+
+    /**
+     * @brief Execute function with a pooled resource (bracket pattern)
+     */
+    template <typename F>
+    auto with_resource(F&& f)
+        -> PoolResult<std::conditional_t<std::is_void_v<std::invoke_result_t<F, T&>>,
+                                         Unit,
+                                         std::invoke_result_t<F, T&>>> {
+        using RawR = std::invoke_result_t<F, T&>;
+        using R = std::conditional_t<std::is_void_v<RawR>, Unit, RawR>;
+
+        auto acquired = acquire();
+        if (acquired.is_err()) {
+            return PoolResult<R>::err(std::move(acquired).error());
+        }
+
+        auto resource = std::move(acquired).value();
+        if constexpr (std::is_void_v<RawR>) {
+            f(resource.get());
+            return PoolResult<R>::ok(unit);
+        } else {
+            return PoolResult<R>::ok(f(resource.get()));
+        }
+    }
+
+    /**
+     * @brief Get pool statistics (pure read)
+     */
+    [[nodiscard]] auto stats() const -> PoolStats {
+        return PoolStats{
+            .available = idle_.count(),
+            .in_use = in_use_,
+            .total_created = total_created_,
+            .max_size = N,
+        };
+    }
+
+  private:
+    friend Handle;
+
+    struct Slot {
+        alignas(T) std::byte storage[sizeof(T)];
+        StaticPool* owner;
+        std::uint32_t generation{0}; // odd while checked out
+
+        auto object() -> T* { return std::launder(reinterpret_cast<T*>(storage)); }
+        auto object() const -> const T* {
+            return std::launder(reinterpret_cast<const T*>(storage));
+        }
+    };
+
+    auto construct_in(std::size_t index) -> PoolResult<Unit> {
+        if constexpr (ResourceEmplacer<Factory, T>) {
+            Emplacer<T> emplacer(slots_[index].storage);
+            auto result = factory_(emplacer);
+            if (result.is_err()) {
+                if (emplacer.constructed()) {
+                    slots_[index].object()->~T();
+                }
+                return PoolResult<Unit>::err(
+                    PoolError(PoolErrc::factory_failed, std::move(result).error()));
+            }
+            if (!emplacer.constructed()) {
+                return PoolResult<Unit>::err(
+                    PoolError(PoolErrc::factory_failed, "factory returned without emplacing"));
+            }
+        } else {
+            auto result = factory_();
+            if (result.is_err()) {
+                return PoolResult<Unit>::err(
+                    PoolError(PoolErrc::factory_failed, std::move(result).error()));
+            }
+            ::new (static_cast<void*>(slots_[index].storage)) T(std::move(result).value());
+        }
+        ++total_created_;
+        return PoolResult<Unit>::ok(unit);
+    }
+
+    // Slot is already marked neither idle nor vacant by the caller
+    auto create_in(std::size_t index) -> PoolResult<Handle> {
+        auto constructed = construct_in(index);
+        if (constructed.is_err()) {
+            vacant_.set(index);
+            return PoolResult<Handle>::err(std::move(constructed).error());
+        }
+
+        return PoolResult<Handle>::ok(check_out(index));
+    }
+
+    auto handle_of(const Slot& slot) const -> SlotHandle {
+        return SlotHandle{static_cast<std::uint32_t>(&slot - slots_.data()), slot.generation};
+    }
+
+    auto check_out(std::size_t index) -> Handle {
+        ++in_use_;
+        ++slots_[index].generation;
+        return Handle(&slots_[index]);
+    }
+
+    void release_slot(Slot& slot) {
+        auto index = static_cast<std::size_t>(&slot - slots_.data());
+        --in_use_;
+        ++slot.generation;
+
+        T& resource = *slot.object();
+
+        // Reset resource; discard it if it cannot be reset or is invalid
+        if (resetter_(resource).is_err() ||
+            (Config.validate_on_release && !validator_(resource))) {
+            resource.~T();
+            vacant_.set(index);
+            return;
+        }
+
+        idle_.set(index);
+        detail::poison_idle(resource);
+    }
+
+    [[no_unique_address]] Factory factory_;
+    [[no_unique_address]] Validator validator_;
+    [[no_unique_address]] Resetter resetter_;
+
+    SlotBitmap<N> idle_;
+    SlotBitmap<N> vacant_;
+    std::size_t in_use_{0};
+    std::size_t total_created_{0};
+
+    std::array<Slot, N> slots_;
+};
+
+/**
+ * @brief Create a StaticPool, deducing the lifecycle hook types
+ *
+ * Returned by value (guaranteed elision); the pool itself is immovable.
+ *
+ *   auto pool = make_static_pool<Block, 32>(factory);
+ *   auto pool = make_static_pool<Block, 32>([](Emplacer<Block>& e) {
+ *       e.emplace(args...);
+ *       return Result<Unit>::ok(unit);
+ *   });
+ *   auto pool = make_static_pool<Block, 32, default_static_config.with_min_size(8)>(
+ *       factory, validator, resetter);
+ */
+template <std::destructible T,
+          std::size_t N,
+          StaticPoolConfig Config = default_static_config,
+          typename Factory,
+          typename Validator = detail::AlwaysValid,
+          typename Resetter = detail::NoReset>
+    requires(ResourceFactory<Factory, T> || ResourceEmplacer<Factory, T>) &&
+            ResourceValidator<Validator, T> && ResourceResetter<Resetter, T>
+[[nodiscard]] auto
+make_static_pool(Factory factory, Validator validator = {}, Resetter resetter = {}) {
+    return StaticPool<T, N, Factory, Validator, Resetter, Config>(
+        std::move(factory), std::move(validator), std::move(resetter));
+}
+
+} // namespace poolfactory
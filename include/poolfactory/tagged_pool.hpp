@@ -0,0 +1,259 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "poolfactory/cache_line.hpp"
+#include "poolfactory/concepts.hpp"
+#include "poolfactory/pool.hpp"
+#include "poolfactory/pool_config.hpp"
+#include "poolfactory/pool_error.hpp"
+#include "poolfactory/pooled_resource.hpp"
+#include "poolfactory/result.hpp"
+#include "poolfactory/unit.hpp"
+
+namespace poolfactory {
+
+// Forward declaration
+class PoolFactory;
+
+namespace detail {
+
+// Tag type produced by a tagger
+template <typename Tagger, typename T>
+using TagOf = std::decay_t<std::invoke_result_t<Tagger, const T&>>;
+
+} // namespace detail
+
+/**
+ * @brief TaggedPool statistics
+ */
+struct TaggedStats {
+    PoolStats pool;
+    std::size_t hits;   // acquires served by an idle resource with the wanted tag
+    std::size_t misses; // acquires that created or re-purposed a resource
+
+    constexpr auto operator==(const TaggedStats&) const -> bool = default;
+};
+
+/**
+ * @brief Thread-safe pool whose idle resources are indexed by a state tag
+ *
+ * The tagger maps a resource to a key of its session state (selected
+ * database, locale, ...); it is read when a resource is released and the
+ * resource is filed under that key. acquire(tag) then finds a resource in
+ * the wanted state in O(1). Without one it creates a resource while the
+ * pool has room, and otherwise hands out an idle resource of another tag,
+ * which the caller must switch over.
+ *
+ * There is no resetter: the state is what callers want to reuse.
+ */
+template <Poolable T, typename Tag> class TaggedPool {
+  public:
+    using Factory = std::function<Result<T>()>;
+    using Tagger = std::function<Tag(const T&)>;
+    using Validator = std::function<bool(const T&)>;
+
+    TaggedPool(const TaggedPool&) = delete;
+    auto operator=(const TaggedPool&) -> TaggedPool& = delete;
+    TaggedPool(TaggedPool&&) = delete;
+    auto operator=(TaggedPool&&) -> TaggedPool& = delete;
+
+    ~TaggedPool() = default;
+
+    /**
+     * @brief Acquire a resource, preferring one whose state has `tag`
+     */
+    [[nodiscard]] auto acquire(const Tag& tag) -> PoolResult<PooledResource<T>> {
+        auto acquired = acquire_resource(tag);
+        if (acquired.is_err()) {
+            return PoolResult<PooledResource<T>>::err(std::move(acquired).error());
+        }
+        auto releaser = [this](T r) { release_resource(std::move(r)); };
+        return PoolResult<PooledResource<T>>::ok(
+            PooledResource<T>(std::move(acquired).value(), std::move(releaser)));
+    }
+
+    /**
+     * @brief Execute function with a resource, preferring one whose state has `tag`
+     */
+    template <typename F>
+    auto with_resource(const Tag& tag, F&& f)
+        -> PoolResult<std::conditional_t<std::is_void_v<std::invoke_result_t<F, T&>>,
+                                         Unit,
+                                         std::invoke_result_t<F, T&>>> {
+        using RawR = std::invoke_result_t<F, T&>;
+        using R = std::conditional_t<std::is_void_v<RawR>, Unit, RawR>;
+
+        auto acquired = acquire_resource(tag);
+        if (acquired.is_err()) {
+            return PoolResult<R>::err(std::move(acquired).error());
+        }
+
+        T resource = std::move(acquired).value();
+        detail::ReleaseOnExit<TaggedPool, T> guard(*this, resource);
+        if constexpr (std::is_void_v<RawR>) {
+            f(resource);
+            return PoolResult<R>::ok(unit);
+        } else {
+            return PoolResult<R>::ok(f(resource));
+        }
+    }
+
+    [[nodiscard]] auto stats() const -> TaggedStats {
+        std::lock_guard lock(mutex_);
+        return TaggedStats{
+            .pool =
+                PoolStats{
+                    .available = idle_count_,
+                    .in_use = in_use_,
+                    .total_created = total_created_,
+                    .max_size = config_.max_size,
+                },
+            .hits = hits_,
+            .misses = misses_,
+        };
+    }
+
+    [[nodiscard]] auto config() const -> const PoolConfig& { return config_; }
+
+  private:
+    friend class PoolFactory;
+    friend class detail::ReleaseOnExit<TaggedPool, T>;
+
+    using IdleMap = std::unordered_map<Tag, std::vector<T>>;
+
+    TaggedPool(Factory factory, Tagger tagger, Validator validator, PoolConfig config)
+        : factory_(std::move(factory)), tagger_(std::move(tagger)),
+          validator_(std::move(validator)), config_(config) {
+        // Pre-warm pool to min_size
+        for (std::size_t i = 0; i < config_.min_size; ++i) {
+            auto result = factory_();
+            if (result.is_ok()) {
+                file_idle(std::move(result).value());
+                ++total_created_;
+            }
+        }
+    }
+
+    auto acquire_resource(const Tag& tag) -> PoolResult<T> {
+        std::unique_lock lock(mutex_);
+
+        // Wait for available resource or room to create new one
+        if (idle_count_ == 0 && in_use_ >= config_.max_size) {
+            auto deadline = std::chrono::steady_clock::now() + config_.acquire_timeout;
+            auto ready = [this] { return idle_count_ > 0 || in_use_ < config_.max_size; };
+            if (!cv_.wait_until(lock, deadline, ready)) {
+                return PoolResult<T>::err(PoolErrc::timeout);
+            }
+        }
+
+        for (auto it = idle_.find(tag); it != idle_.end(); it = idle_.find(tag)) {
+            T resource = take_idle(it);
+            if (usable(resource)) {
+                ++hits_;
+                ++in_use_;
+                return PoolResult<T>::ok(std::move(resource));
+            }
+        }
+
+        ++misses_;
+        if (in_use_ + idle_count_ < config_.max_size) {
+            auto created = create_unlocked();
+            if (created.is_ok() || idle_count_ == 0) {
+                return created;
+            }
+        }
+
+        // Full, or the factory failed: re-purpose an idle resource of another tag
+        while (!idle_.empty()) {
+            T resource = take_idle(idle_.begin());
+            if (usable(resource)) {
+                ++in_use_;
+                return PoolResult<T>::ok(std::move(resource));
+            }
+        }
+        return create_unlocked();
+    }
+
+    void release_resource(T resource) {
+        {
+            std::lock_guard lock(mutex_);
+            --in_use_;
+            if (!(config_.validate_on_release && validator_ && !validator_(resource))) {
+                file_idle(std::move(resource));
+            }
+        }
+        cv_.notify_one();
+    }
+
+    auto create_unlocked() -> PoolResult<T> {
+        auto result = factory_();
+        if (result.is_err()) {
+            return PoolResult<T>::err(
+                PoolError(PoolErrc::factory_failed, std::move(result).error()));
+        }
+
+        ++total_created_;
+        ++in_use_;
+        return PoolResult<T>::ok(std::move(result).value());
+    }
+
+    auto usable(const T& resource) const -> bool {
+        return !(config_.validate_on_acquire && validator_ && !validator_(resource));
+    }
+
+    // Most recently released first: its state is the most likely still warm
+    auto take_idle(typename IdleMap::iterator it) -> T {
+        T resource = std::move(it->second.back());
+        it->second.pop_back();
+        if (it->second.empty()) {
+            auto node = idle_.extract(it);
+            if (spare_.empty()) {
+                spare_ = std::move(node);
+            }
+        }
+        --idle_count_;
+        return resource;
+    }
+
+    void file_idle(T resource) {
+        auto tag = tagger_(resource);
+        auto it = idle_.find(tag);
+        if (it == idle_.end() && spare_.empty()) {
+            it = idle_.try_emplace(std::move(tag)).first;
+        } else if (it == idle_.end()) {
+            spare_.key() = std::move(tag);
+            it = idle_.insert(std::move(spare_)).position;
+        }
+        it->second.push_back(std::move(resource));
+        ++idle_count_;
+    }
+
+    Factory factory_;
+    Tagger tagger_;
+    Validator validator_;
+    PoolConfig config_;
+
+    // Everything below is guarded by mutex_
+    alignas(cache_line_size) mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    // Only non-empty buckets stay in the map; the last emptied node is kept
+    // as a spare so a tag's acquire/release round trip does not reallocate
+    IdleMap idle_;
+    typename IdleMap::node_type spare_;
+    std::size_t idle_count_{0}; // total across buckets
+    std::size_t in_use_{0};
+    std::size_t total_created_{0};
+    std::size_t hits_{0};
+    std::size_t misses_{0};
+};
+
+} // namespace poolfactory
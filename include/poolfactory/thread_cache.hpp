@@ -0,0 +1,55 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace poolfactory {
+
+namespace detail {
+
+/**
+ * @brief Ids of live pools that keep per-thread state in thread_local caches
+ *
+ * Ids are never reused, so a cached id of a destroyed pool can never match
+ * again; pruning only keeps the caches from growing.
+ */
+class ThreadLocalRegistry {
+  public:
+    static auto register_pool() -> std::uint64_t {
+        std::lock_guard lock(mutex());
+        auto id = next_id()++;
+        live().insert(id);
+        return id;
+    }
+
+    static void unregister_pool(std::uint64_t id) {
+        std::lock_guard lock(mutex());
+        live().erase(id);
+    }
+
+    template <typename Entry> static void prune(std::vector<Entry>& cache) {
+        std::lock_guard lock(mutex());
+        std::erase_if(cache, [](const Entry& entry) { return !live().contains(entry.pool_id); });
+    }
+
+  private:
+    static auto mutex() -> std::mutex& {
+        static std::mutex instance;
+        return instance;
+    }
+    static auto next_id() -> std::uint64_t& {
+        static std::uint64_t instance{1};
+        return instance;
+    }
+    static auto live() -> std::unordered_set<std::uint64_t>& {
+        static std::unordered_set<std::uint64_t> instance;
+        return instance;
+    }
+};
+
+} // namespace detail
+
+} // namespace poolfactory
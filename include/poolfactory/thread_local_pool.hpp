@@ -0,0 +1,221 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "poolfactory/cache_line.hpp"
+#include "poolfactory/concepts.hpp"
+#include "poolfactory/pool.hpp"
+#include "poolfactory/pool_config.hpp"
+#include "poolfactory/pool_error.hpp"
+#include "poolfactory/result.hpp"
+#include "poolfactory/thread_cache.hpp"
+
+namespace poolfactory {
+
+template <Poolable T> class ThreadLocalPool;
+
+/**
+ * @brief One thread's share of a ThreadLocalPool
+ *
+ * A single-threaded pool owned by one thread. Releases from the owner go
+ * straight back to the idle list with no atomic read-modify-write; releases
+ * from any other thread are pushed onto a lock-free MPSC stack, which the
+ * owner takes in one exchange and recycles when its idle list runs dry.
+ * Remotely released resources are reset on the owner thread.
+ */
+template <Poolable T> class ThreadLocalShard final : public BasicPool<ThreadLocalShard<T>, T> {
+    using Base = BasicPool<ThreadLocalShard<T>, T>;
+
+  public:
+    using typename Base::Factory;
+    using typename Base::Validator;
+    using typename Base::Resetter;
+
+    ~ThreadLocalShard() {
+        auto* node = remote_.exchange(nullptr, std::memory_order_acquire);
+        while (node != nullptr) {
+            delete std::exchange(node, node->next);
+        }
+    }
+
+    /**
+     * @brief Get shard statistics (owner thread only)
+     *
+     * Resources released remotely and not yet drained still count as in use.
+     */
+    [[nodiscard]] auto stats() const -> PoolStats { return this->stats_unlocked(); }
+
+    [[nodiscard]] auto owner() const -> std::thread::id { return owner_; }
+
+  private:
+    friend class ThreadLocalPool<T>;
+    friend Base;
+    friend class detail::ReleaseOnExit<ThreadLocalShard<T>, T, std::size_t>;
+
+    struct RemoteNode {
+        T value;
+        std::size_t charged;
+        RemoteNode* next;
+    };
+
+    ThreadLocalShard(Factory factory,
+                     Validator validator,
+                     Resetter resetter,
+                     PoolConfig config,
+                     std::thread::id owner)
+        : Base(std::move(factory), std::move(validator), std::move(resetter), config),
+          owner_(owner) {}
+
+    auto acquire_resource() -> PoolResult<T> {
+        if (this->available_.empty()) {
+            drain_remote();
+        }
+        return this->acquire_unlocked();
+    }
+
+    void release_resource(T resource, std::size_t charged) {
+        if (std::this_thread::get_id() == owner_) {
+            this->release_unlocked(std::move(resource), charged);
+        } else {
+            push_remote(std::move(resource), charged);
+        }
+    }
+
+    void push_remote(T resource, std::size_t charged) {
+        auto* node =
+            new RemoteNode{std::move(resource), charged, remote_.load(std::memory_order_relaxed)};
+        while (!remote_.compare_exchange_weak(
+            node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    // Owner only: take the whole stack at once, then recycle it locally
+    void drain_remote() {
+        if (remote_.load(std::memory_order_relaxed) == nullptr) {
+            return;
+        }
+        auto* node = remote_.exchange(nullptr, std::memory_order_acquire);
+        while (node != nullptr) {
+            this->release_unlocked(std::move(node->value), node->charged);
+            delete std::exchange(node, node->next);
+        }
+    }
+
+    std::thread::id owner_;
+
+    // Written by other threads: kept off the owner's hot line
+    alignas(cache_line_size) std::atomic<RemoteNode*> remote_{nullptr};
+};
+
+/**
+ * @brief Thread-affine pool: every thread gets its own ThreadLocalShard
+ *
+ * acquire()/with_resource() use the calling thread's shard, found through a
+ * thread-local cache, so the same-thread path takes no lock and performs no
+ * atomic read-modify-write. A PooledResource may be released on any thread;
+ * it returns to the shard it came from. The config (min/max size) applies
+ * per thread, and the lifecycle hooks are shared by all threads, so they
+ * must be thread-safe. A shard outlives its thread; its idle resources are
+ * only reused if that thread calls in again.
+ */
+template <Poolable T> class ThreadLocalPool {
+  public:
+    using Shard = ThreadLocalShard<T>;
+    using Factory = typename Shard::Factory;
+    using Validator = typename Shard::Validator;
+    using Resetter = typename Shard::Resetter;
+
+    ThreadLocalPool(const ThreadLocalPool&) = delete;
+    auto operator=(const ThreadLocalPool&) -> ThreadLocalPool& = delete;
+    ThreadLocalPool(ThreadLocalPool&&) = delete;
+    auto operator=(ThreadLocalPool&&) -> ThreadLocalPool& = delete;
+
+    ~ThreadLocalPool() { detail::ThreadLocalRegistry::unregister_pool(id_); }
+
+    /**
+     * @brief Acquire a resource from the calling thread's shard
+     */
+    [[nodiscard]] auto acquire() -> PoolResult<PooledResource<T>> {
+        return local_shard().acquire();
+    }
+
+    /**
+     * @brief Execute function with a resource from the calling thread's shard
+     */
+    template <typename F> auto with_resource(F&& f) {
+        return local_shard().with_resource(std::forward<F>(f));
+    }
+
+    /**
+     * @brief Statistics of the calling thread's shard
+     */
+    [[nodiscard]] auto stats() -> PoolStats { return local_shard().stats(); }
+
+    [[nodiscard]] auto config() const -> const PoolConfig& { return config_; }
+
+    [[nodiscard]] auto shard_count() const -> std::size_t {
+        std::lock_guard lock(mutex_);
+        return shards_.size();
+    }
+
+  private:
+    friend class PoolFactory;
+
+    struct CacheEntry {
+        std::uint64_t pool_id;
+        Shard* shard;
+    };
+
+    ThreadLocalPool(Factory factory, Validator validator, Resetter resetter, PoolConfig config)
+        : factory_(std::move(factory)), validator_(std::move(validator)),
+          resetter_(std::move(resetter)), config_(config),
+          id_(detail::ThreadLocalRegistry::register_pool()) {}
+
+    auto local_shard() -> Shard& {
+        for (const auto& entry : cache()) {
+            if (entry.pool_id == id_) {
+                return *entry.shard;
+            }
+        }
+        return register_thread();
+    }
+
+    // First call from this thread: create its shard (once per thread and pool)
+    auto register_thread() -> Shard& {
+        auto& entries = cache();
+        detail::ThreadLocalRegistry::prune(entries);
+
+        Shard* shard = nullptr;
+        {
+            std::lock_guard lock(mutex_);
+            shards_.push_back(std::unique_ptr<Shard>(
+                new Shard(factory_, validator_, resetter_, config_, std::this_thread::get_id())));
+            shard = shards_.back().get();
+        }
+        entries.push_back(CacheEntry{id_, shard});
+        return *shard;
+    }
+
+    static auto cache() -> std::vector<CacheEntry>& {
+        thread_local std::vector<CacheEntry> entries;
+        return entries;
+    }
+
+    Factory factory_;
+    Validator validator_;
+    Resetter resetter_;
+    PoolConfig config_;
+    std::uint64_t id_;
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+} // namespace poolfactory
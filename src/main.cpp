@@ -1,9 +1,13 @@
+#include <atomic>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
 
 #include "poolfactory/pool_factory.hpp"
+#include "poolfactory/result_combinators.hpp"
+#include "poolfactory/static_pool.hpp"
 
 using namespace poolfactory;
 
@@ -53,9 +57,12 @@ auto demo_connection_pool() -> void {
                       << ", max=" << pool->stats().max_size << std::endl;
 
             // Use bracket pattern - safest way
-            pool->with_resource([](Connection& conn) {
+            auto used = pool->with_resource([](Connection& conn) {
                 std::cout << "Using connection #" << conn.id << " to " << conn.host << std::endl;
             });
+            if (used.is_err()) {
+                std::cout << "Error: " << used.error() << std::endl;
+            }
 
             // Acquire explicitly
             auto conn1 = pool->acquire();
@@ -114,12 +121,15 @@ auto demo_memory_pool() -> void {
             std::cout << "Pre-warmed: " << pool->stats().available << " blocks" << std::endl;
 
             // Use memory block
-            pool->with_resource([](Block& block) {
+            auto used = pool->with_resource([](Block& block) {
                 auto* ptr = static_cast<int*>(block.ptr());
                 *ptr = 42;
                 block.dirty = true;
                 std::cout << "Wrote value " << *ptr << " to block" << std::endl;
             });
+            if (used.is_err()) {
+                std::cout << "Error: " << used.error() << std::endl;
+            }
 
             std::cout << "After use: available=" << pool->stats().available << std::endl;
         },
@@ -162,11 +172,14 @@ auto demo_thread_safe_pool() -> void {
             // Spawn multiple threads that compete for resources
             for (int i = 0; i < 6; ++i) {
                 threads.emplace_back([pool, i]() {
-                    pool->with_resource([i](Worker& w) {
+                    auto used = pool->with_resource([i](Worker& w) {
                         w.status = "working";
                         std::cout << "Thread " << i << " using worker #" << w.id << std::endl;
                         std::this_thread::sleep_for(std::chrono::milliseconds(50));
                     });
+                    if (used.is_err()) {
+                        std::cout << "Thread " << i << " failed: " << used.error() << std::endl;
+                    }
                 });
             }
 
@@ -179,6 +192,31 @@ auto demo_thread_safe_pool() -> void {
         },
         [](const auto& err) { std::cout << "Failed: " << err << std::endl; });
 
+    // Thread-affine variant: each thread works on its own shard, no locking
+    std::atomic<int> shared_id{0};
+    auto local_pool = PoolFactory::create_thread_local<Worker>(
+        [&shared_id]() { return Result<Worker>::ok(Worker{++shared_id}); },
+        default_config.with_max_size(2));
+    if (local_pool.is_ok()) {
+        auto pool = local_pool.value();
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 3; ++i) {
+            threads.emplace_back([pool]() {
+                for (int n = 0; n < 100; ++n) {
+                    auto used = pool->with_resource([](Worker& w) { w.status = "working"; });
+                    if (used.is_err()) {
+                        std::cout << "Error: " << used.error() << std::endl;
+                    }
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        std::cout << "Thread-local pool: " << pool->shard_count()
+                  << " shards, workers created: " << shared_id << std::endl;
+    }
+
     std::cout << std::endl;
 }
 
@@ -192,16 +230,130 @@ auto demo_monadic_chaining() -> void {
     auto factory = []() -> Result<int> { return Result<int>::ok(10); };
 
     // Chain pool creation with resource usage
-    make_pool<int>(factory, default_config.with_max_size(3))
-        .and_then([](auto pool) { return pool->with_resource([](int& n) { return n * 2; }); })
-        .map([](int result) {
-            std::cout << "Computed result: " << result << std::endl;
-            return result;
-        })
-        .or_else([](const std::string& err) {
-            std::cout << "Error in chain: " << err << std::endl;
-            return Result<int>::err(err);
-        });
+    [[maybe_unused]] auto computed =
+        make_pool<int>(factory, default_config.with_max_size(3))
+            .and_then([](auto pool) { return pool->with_resource([](int& n) { return n * 2; }); })
+            .map([](int result) {
+                std::cout << "Computed result: " << result << std::endl;
+                return result;
+            })
+            .or_else([](const PoolError& err) {
+                std::cout << "Error in chain: " << err << std::endl;
+                return PoolResult<int>::err(err);
+            });
+
+    std::cout << std::endl;
+}
+
+// =============================================================================
+// Example 5: Heap-Free Static Pool
+// =============================================================================
+
+auto demo_static_pool() -> void {
+    std::cout << "=== Static Pool Demo ===" << std::endl;
+
+    using Block = MemoryBlock<256>;
+
+    // Capacity and config are template arguments; storage lives inline
+    auto pool = make_static_pool<Block, 4, default_static_config.with_min_size(2)>(
+        []() -> Result<Block> { return Result<Block>::ok(Block{}); });
+
+    std::cout << "Static pool: capacity=" << pool.capacity
+              << ", pre-warmed=" << pool.stats().available
+              << ", handle size=" << sizeof(decltype(pool)::Handle) << " bytes" << std::endl;
+
+    {
+        auto a = pool.acquire();
+        auto b = pool.acquire();
+        std::cout << "After two acquires: in_use=" << pool.stats().in_use << std::endl;
+    }
+
+    auto used = pool.with_resource([](Block& block) { block.dirty = true; });
+    if (used.is_err()) {
+        std::cout << "Error: " << used.error() << std::endl;
+    }
+    std::cout << "After release: available=" << pool.stats().available << std::endl;
+
+    // Emplacing factory: Session holds a mutex, so it cannot be moved at all;
+    // it is constructed directly in its slot
+    struct Session {
+        std::mutex lock;
+        int id;
+
+        explicit Session(int i) : id(i) {}
+    };
+
+    int next_id = 0;
+    auto sessions = make_static_pool<Session, 2>([&next_id](Emplacer<Session>& slot) {
+        slot.emplace(++next_id);
+        return Result<Unit>::ok(unit);
+    });
+    auto session = sessions.with_resource([](Session& s) {
+        std::lock_guard guard(s.lock);
+        return s.id;
+    });
+    if (session.is_ok()) {
+        std::cout << "Emplaced session #" << session.value() << std::endl;
+    }
+
+    // Generational handles: index + generation, stale after release
+    auto handle = pool.acquire_handle();
+    if (handle.is_ok()) {
+        auto h = handle.value();
+        pool.get(h).dirty = true;
+        pool.release(h);
+        std::cout << "Handle after release: live=" << pool.is_live(h) << std::endl;
+    }
+
+    std::cout << std::endl;
+}
+
+// =============================================================================
+// Example 6: Parallel Combinators
+// =============================================================================
+
+auto demo_combinators() -> void {
+    std::cout << "=== Parallel Combinators Demo ===" << std::endl;
+
+    auto connections = make_thread_safe_pool<Connection>(
+        []() { return Result<Connection>::ok(Connection{"db:5432", 1}); },
+        connection_pool_config.with_max_size(2));
+    auto workers =
+        make_thread_safe_pool<Worker>([]() { return Result<Worker>::ok(Worker{7}); },
+                                      thread_pool_config.with_min_size(1).with_max_size(2));
+    if (connections.is_err() || workers.is_err()) {
+        std::cout << "Failed to create pools" << std::endl;
+        return;
+    }
+
+    ThreadPoolExecutor executor(2);
+
+    // Independent calls against two pools, run concurrently
+    auto both = when_all(
+        executor,
+        [&] { return connections.value()->with_resource([](Connection& c) { return c.host; }); },
+        [&] { return workers.value()->with_resource([](Worker& w) { return w.id; }); });
+    both.match(
+        [](const auto& values) {
+            std::cout << "when_all: host=" << std::get<0>(values)
+                      << ", worker=" << std::get<1>(values) << std::endl;
+        },
+        [](const PoolError& err) { std::cout << "when_all failed: " << err << std::endl; });
+
+    // The first error cancels the rest; later inputs see stop requested
+    std::vector<int> ids{1, 2, -3, 4};
+    auto checked = traverse(executor, ids, [](int id, std::stop_token token) -> Result<int> {
+        if (token.stop_requested()) {
+            return Result<int>::err("cancelled");
+        }
+        return id > 0 ? Result<int>::ok(id * 10) : Result<int>::err("negative id");
+    });
+    if (checked.is_err()) {
+        std::cout << "traverse stopped: " << checked.error() << std::endl;
+    }
+
+    auto all = sequence(std::vector{Result<int>::ok(1), Result<int>::ok(2)});
+    std::cout << "sequence: " << all.value().size() << " values" << std::endl;
 
     std::cout << std::endl;
 }
@@ -215,6 +367,8 @@ auto main() -> int {
     demo_memory_pool();
     demo_thread_safe_pool();
     demo_monadic_chaining();
+    demo_static_pool();
+    demo_combinators();
 
     return 0;
 }